@@ -3,6 +3,8 @@
 #include "Timer.h"
 #include "echo_service.pb.h"
 #include "rpc_channel.h"
+#include "rpc_controller.h"
+#include "rpc_stream.h"
 #include <iostream>
 
 using namespace toyBasket;
@@ -20,6 +22,15 @@ void PrintDoneCallback(toyBasket::EchoResponse *response) {
   std::cout << "Print: " << response->DebugString() << std::endl;
 }
 
+void SubscribeDoneCallback(toyBasket::RpcController *controller,
+                           toyBasket::EchoResponse *response) {
+  if (controller->Failed()) {
+    std::cout << "Subscribe failed: " << controller->ErrorText() << std::endl;
+  } else {
+    std::cout << "Subscribe: " << response->DebugString() << std::endl;
+  }
+}
+
 int main(int argc, char *argv[]) {
   if (argc < 3) {
     print_usage();
@@ -60,6 +71,20 @@ int main(int argc, char *argv[]) {
       },
       true, false);
 
+  // updates are pushed by the server on one streaming call
+  toyBasket::RpcController subscribe_controller;
+  toyBasket::EchoResponse subscribe_response;
+  subscribe_controller.Stream()->SetMessageCallback(
+      [](const google::protobuf::Message &message) {
+        std::cout << "update: " << message.ShortDebugString() << std::endl;
+      });
+  loop.runAfter(1.0, [&] {
+    stub.Subscribe(&subscribe_controller, &request, &subscribe_response,
+                   ::google::protobuf::NewCallback(&SubscribeDoneCallback,
+                                                   &subscribe_controller,
+                                                   &subscribe_response));
+  });
+
   loop.loop();
 
   return 0;
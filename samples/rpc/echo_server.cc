@@ -1,14 +1,17 @@
 #include "EventLoop.h"
 #include "InetAddress.h"
 #include "echo_service.pb.h"
+#include "rpc_controller.h"
 #include "rpc_server.h"
+#include "rpc_stream.h"
 #include <iostream>
+#include <memory>
 
 using namespace toyBasket;
 
 class EchoServerImpl : public toyBasket::EchoServer {
 public:
-  EchoServerImpl() {}
+  explicit EchoServerImpl(EventLoop *loop) : loop_(loop) {}
   virtual ~EchoServerImpl() {}
 
 private:
@@ -32,6 +35,37 @@ private:
                           request->message() + std::string("***"));
     done->Run();
   }
+  // pushes one update per second on the same call, the client does not poll
+  virtual void Subscribe(google::protobuf::RpcController *controller,
+                         const toyBasket::EchoRequest *request,
+                         toyBasket::EchoResponse *response,
+                         google::protobuf::Closure *done) {
+    toyBasket::RpcController *rpc_controller =
+        static_cast<toyBasket::RpcController *>(controller);
+    toyBasket::RpcStream *stream = rpc_controller->Stream();
+    std::string topic = request->message();
+    std::shared_ptr<int> count = std::make_shared<int>(0);
+    std::shared_ptr<TimerId> timer = std::make_shared<TimerId>();
+    *timer = loop_->runEvery(1.0, [=] {
+      if (rpc_controller->IsCanceled() || *count == 10) {
+        loop_->cancel(*timer);
+        response->set_message("[Subscribe] server say: " +
+                              std::to_string(*count) + " updates sent");
+        done->Run();
+        return;
+      }
+      toyBasket::EchoResponse update;
+      update.set_message("[Subscribe] update " + std::to_string(*count) +
+                         " for ***" + topic + "***");
+      // no credit left: the client is slow, skip this update
+      if (stream->Write(update)) {
+        ++*count;
+      }
+    });
+  }
+
+private:
+  EventLoop *loop_;
 };
 
 int main(int argc, char *argv[]) {
@@ -39,7 +73,7 @@ int main(int argc, char *argv[]) {
   InetAddress server("127.0.0.1", 12321);
   toyBasket::RpcServer rpc_server(&loop, server);
 
-  toyBasket::EchoServer *echo_service = new EchoServerImpl();
+  toyBasket::EchoServer *echo_service = new EchoServerImpl(&loop);
   if (!rpc_server.RegisterService(echo_service, false)) {
     std::cout << "register service failed" << std::endl;
     return -1;
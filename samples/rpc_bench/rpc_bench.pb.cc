@@ -0,0 +1,990 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: rpc_bench.proto
+
+#include "rpc_bench.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace toyBasket {
+PROTOBUF_CONSTEXPR BenchRequest::BenchRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.payload_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.response_size_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BenchRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BenchRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BenchRequestDefaultTypeInternal() {}
+  union {
+    BenchRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BenchRequestDefaultTypeInternal _BenchRequest_default_instance_;
+PROTOBUF_CONSTEXPR BenchResponse::BenchResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.payload_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BenchResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BenchResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BenchResponseDefaultTypeInternal() {}
+  union {
+    BenchResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BenchResponseDefaultTypeInternal _BenchResponse_default_instance_;
+PROTOBUF_CONSTEXPR StatsRequest::StatsRequest(
+    ::_pbi::ConstantInitialized) {}
+struct StatsRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StatsRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StatsRequestDefaultTypeInternal() {}
+  union {
+    StatsRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StatsRequestDefaultTypeInternal _StatsRequest_default_instance_;
+PROTOBUF_CONSTEXPR StatsResponse::StatsResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.calls_)*/uint64_t{0u}
+  , /*decltype(_impl_.user_cpu_us_)*/uint64_t{0u}
+  , /*decltype(_impl_.system_cpu_us_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct StatsResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StatsResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StatsResponseDefaultTypeInternal() {}
+  union {
+    StatsResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StatsResponseDefaultTypeInternal _StatsResponse_default_instance_;
+}  // namespace toyBasket
+static ::_pb::Metadata file_level_metadata_rpc_5fbench_2eproto[4];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_rpc_5fbench_2eproto = nullptr;
+static const ::_pb::ServiceDescriptor* file_level_service_descriptors_rpc_5fbench_2eproto[1];
+
+const uint32_t TableStruct_rpc_5fbench_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::toyBasket::BenchRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::toyBasket::BenchRequest, _impl_.payload_),
+  PROTOBUF_FIELD_OFFSET(::toyBasket::BenchRequest, _impl_.response_size_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::toyBasket::BenchResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::toyBasket::BenchResponse, _impl_.payload_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::toyBasket::StatsRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::toyBasket::StatsResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::toyBasket::StatsResponse, _impl_.calls_),
+  PROTOBUF_FIELD_OFFSET(::toyBasket::StatsResponse, _impl_.user_cpu_us_),
+  PROTOBUF_FIELD_OFFSET(::toyBasket::StatsResponse, _impl_.system_cpu_us_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::toyBasket::BenchRequest)},
+  { 8, -1, -1, sizeof(::toyBasket::BenchResponse)},
+  { 15, -1, -1, sizeof(::toyBasket::StatsRequest)},
+  { 21, -1, -1, sizeof(::toyBasket::StatsResponse)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::toyBasket::_BenchRequest_default_instance_._instance,
+  &::toyBasket::_BenchResponse_default_instance_._instance,
+  &::toyBasket::_StatsRequest_default_instance_._instance,
+  &::toyBasket::_StatsResponse_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_rpc_5fbench_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\017rpc_bench.proto\022\ttoyBasket\"6\n\014BenchReq"
+  "uest\022\017\n\007payload\030\001 \001(\014\022\025\n\rresponse_size\030\002"
+  " \001(\r\" \n\rBenchResponse\022\017\n\007payload\030\001 \001(\014\"\016"
+  "\n\014StatsRequest\"J\n\rStatsResponse\022\r\n\005calls"
+  "\030\001 \001(\004\022\023\n\013user_cpu_us\030\002 \001(\004\022\025\n\rsystem_cp"
+  "u_us\030\003 \001(\0042\205\001\n\014BenchService\0229\n\004Echo\022\027.to"
+  "yBasket.BenchRequest\032\030.toyBasket.BenchRe"
+  "sponse\022:\n\005Stats\022\027.toyBasket.StatsRequest"
+  "\032\030.toyBasket.StatsResponseB\003\200\001\001b\006proto3"
+  ;
+static ::_pbi::once_flag descriptor_table_rpc_5fbench_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_rpc_5fbench_2eproto = {
+    false, false, 359, descriptor_table_protodef_rpc_5fbench_2eproto,
+    "rpc_bench.proto",
+    &descriptor_table_rpc_5fbench_2eproto_once, nullptr, 0, 4,
+    schemas, file_default_instances, TableStruct_rpc_5fbench_2eproto::offsets,
+    file_level_metadata_rpc_5fbench_2eproto, file_level_enum_descriptors_rpc_5fbench_2eproto,
+    file_level_service_descriptors_rpc_5fbench_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_rpc_5fbench_2eproto_getter() {
+  return &descriptor_table_rpc_5fbench_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_rpc_5fbench_2eproto(&descriptor_table_rpc_5fbench_2eproto);
+namespace toyBasket {
+
+// ===================================================================
+
+class BenchRequest::_Internal {
+ public:
+};
+
+BenchRequest::BenchRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:toyBasket.BenchRequest)
+}
+BenchRequest::BenchRequest(const BenchRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BenchRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.payload_){}
+    , decltype(_impl_.response_size_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.payload_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.payload_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_payload().empty()) {
+    _this->_impl_.payload_.Set(from._internal_payload(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.response_size_ = from._impl_.response_size_;
+  // @@protoc_insertion_point(copy_constructor:toyBasket.BenchRequest)
+}
+
+inline void BenchRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.payload_){}
+    , decltype(_impl_.response_size_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.payload_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.payload_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+BenchRequest::~BenchRequest() {
+  // @@protoc_insertion_point(destructor:toyBasket.BenchRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BenchRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.payload_.Destroy();
+}
+
+void BenchRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BenchRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:toyBasket.BenchRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.payload_.ClearToEmpty();
+  _impl_.response_size_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BenchRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes payload = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_payload();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 response_size = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.response_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BenchRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:toyBasket.BenchRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes payload = 1;
+  if (!this->_internal_payload().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_payload(), target);
+  }
+
+  // uint32 response_size = 2;
+  if (this->_internal_response_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_response_size(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:toyBasket.BenchRequest)
+  return target;
+}
+
+size_t BenchRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:toyBasket.BenchRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes payload = 1;
+  if (!this->_internal_payload().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_payload());
+  }
+
+  // uint32 response_size = 2;
+  if (this->_internal_response_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_response_size());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BenchRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BenchRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BenchRequest::GetClassData() const { return &_class_data_; }
+
+
+void BenchRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BenchRequest*>(&to_msg);
+  auto& from = static_cast<const BenchRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:toyBasket.BenchRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_payload().empty()) {
+    _this->_internal_set_payload(from._internal_payload());
+  }
+  if (from._internal_response_size() != 0) {
+    _this->_internal_set_response_size(from._internal_response_size());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BenchRequest::CopyFrom(const BenchRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:toyBasket.BenchRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BenchRequest::IsInitialized() const {
+  return true;
+}
+
+void BenchRequest::InternalSwap(BenchRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.payload_, lhs_arena,
+      &other->_impl_.payload_, rhs_arena
+  );
+  swap(_impl_.response_size_, other->_impl_.response_size_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BenchRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_rpc_5fbench_2eproto_getter, &descriptor_table_rpc_5fbench_2eproto_once,
+      file_level_metadata_rpc_5fbench_2eproto[0]);
+}
+
+// ===================================================================
+
+class BenchResponse::_Internal {
+ public:
+};
+
+BenchResponse::BenchResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:toyBasket.BenchResponse)
+}
+BenchResponse::BenchResponse(const BenchResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BenchResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.payload_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.payload_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.payload_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_payload().empty()) {
+    _this->_impl_.payload_.Set(from._internal_payload(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:toyBasket.BenchResponse)
+}
+
+inline void BenchResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.payload_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.payload_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.payload_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+BenchResponse::~BenchResponse() {
+  // @@protoc_insertion_point(destructor:toyBasket.BenchResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BenchResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.payload_.Destroy();
+}
+
+void BenchResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BenchResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:toyBasket.BenchResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.payload_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BenchResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes payload = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_payload();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BenchResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:toyBasket.BenchResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes payload = 1;
+  if (!this->_internal_payload().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_payload(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:toyBasket.BenchResponse)
+  return target;
+}
+
+size_t BenchResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:toyBasket.BenchResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes payload = 1;
+  if (!this->_internal_payload().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_payload());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BenchResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BenchResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BenchResponse::GetClassData() const { return &_class_data_; }
+
+
+void BenchResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BenchResponse*>(&to_msg);
+  auto& from = static_cast<const BenchResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:toyBasket.BenchResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_payload().empty()) {
+    _this->_internal_set_payload(from._internal_payload());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BenchResponse::CopyFrom(const BenchResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:toyBasket.BenchResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BenchResponse::IsInitialized() const {
+  return true;
+}
+
+void BenchResponse::InternalSwap(BenchResponse* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.payload_, lhs_arena,
+      &other->_impl_.payload_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BenchResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_rpc_5fbench_2eproto_getter, &descriptor_table_rpc_5fbench_2eproto_once,
+      file_level_metadata_rpc_5fbench_2eproto[1]);
+}
+
+// ===================================================================
+
+class StatsRequest::_Internal {
+ public:
+};
+
+StatsRequest::StatsRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:toyBasket.StatsRequest)
+}
+StatsRequest::StatsRequest(const StatsRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  StatsRequest* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:toyBasket.StatsRequest)
+}
+
+
+
+
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StatsRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StatsRequest::GetClassData() const { return &_class_data_; }
+
+
+
+
+
+
+
+::PROTOBUF_NAMESPACE_ID::Metadata StatsRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_rpc_5fbench_2eproto_getter, &descriptor_table_rpc_5fbench_2eproto_once,
+      file_level_metadata_rpc_5fbench_2eproto[2]);
+}
+
+// ===================================================================
+
+class StatsResponse::_Internal {
+ public:
+};
+
+StatsResponse::StatsResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:toyBasket.StatsResponse)
+}
+StatsResponse::StatsResponse(const StatsResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  StatsResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.calls_){}
+    , decltype(_impl_.user_cpu_us_){}
+    , decltype(_impl_.system_cpu_us_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.calls_, &from._impl_.calls_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.system_cpu_us_) -
+    reinterpret_cast<char*>(&_impl_.calls_)) + sizeof(_impl_.system_cpu_us_));
+  // @@protoc_insertion_point(copy_constructor:toyBasket.StatsResponse)
+}
+
+inline void StatsResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.calls_){uint64_t{0u}}
+    , decltype(_impl_.user_cpu_us_){uint64_t{0u}}
+    , decltype(_impl_.system_cpu_us_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+StatsResponse::~StatsResponse() {
+  // @@protoc_insertion_point(destructor:toyBasket.StatsResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void StatsResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void StatsResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void StatsResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:toyBasket.StatsResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.calls_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.system_cpu_us_) -
+      reinterpret_cast<char*>(&_impl_.calls_)) + sizeof(_impl_.system_cpu_us_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* StatsResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 calls = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.calls_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 user_cpu_us = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.user_cpu_us_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 system_cpu_us = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.system_cpu_us_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* StatsResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:toyBasket.StatsResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 calls = 1;
+  if (this->_internal_calls() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_calls(), target);
+  }
+
+  // uint64 user_cpu_us = 2;
+  if (this->_internal_user_cpu_us() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_user_cpu_us(), target);
+  }
+
+  // uint64 system_cpu_us = 3;
+  if (this->_internal_system_cpu_us() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_system_cpu_us(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:toyBasket.StatsResponse)
+  return target;
+}
+
+size_t StatsResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:toyBasket.StatsResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint64 calls = 1;
+  if (this->_internal_calls() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_calls());
+  }
+
+  // uint64 user_cpu_us = 2;
+  if (this->_internal_user_cpu_us() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_user_cpu_us());
+  }
+
+  // uint64 system_cpu_us = 3;
+  if (this->_internal_system_cpu_us() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_system_cpu_us());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StatsResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    StatsResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StatsResponse::GetClassData() const { return &_class_data_; }
+
+
+void StatsResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<StatsResponse*>(&to_msg);
+  auto& from = static_cast<const StatsResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:toyBasket.StatsResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_calls() != 0) {
+    _this->_internal_set_calls(from._internal_calls());
+  }
+  if (from._internal_user_cpu_us() != 0) {
+    _this->_internal_set_user_cpu_us(from._internal_user_cpu_us());
+  }
+  if (from._internal_system_cpu_us() != 0) {
+    _this->_internal_set_system_cpu_us(from._internal_system_cpu_us());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void StatsResponse::CopyFrom(const StatsResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:toyBasket.StatsResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool StatsResponse::IsInitialized() const {
+  return true;
+}
+
+void StatsResponse::InternalSwap(StatsResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(StatsResponse, _impl_.system_cpu_us_)
+      + sizeof(StatsResponse::_impl_.system_cpu_us_)
+      - PROTOBUF_FIELD_OFFSET(StatsResponse, _impl_.calls_)>(
+          reinterpret_cast<char*>(&_impl_.calls_),
+          reinterpret_cast<char*>(&other->_impl_.calls_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata StatsResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_rpc_5fbench_2eproto_getter, &descriptor_table_rpc_5fbench_2eproto_once,
+      file_level_metadata_rpc_5fbench_2eproto[3]);
+}
+
+// ===================================================================
+
+BenchService::~BenchService() {}
+
+const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* BenchService::descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_rpc_5fbench_2eproto);
+  return file_level_service_descriptors_rpc_5fbench_2eproto[0];
+}
+
+const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* BenchService::GetDescriptor() {
+  return descriptor();
+}
+
+void BenchService::Echo(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                         const ::toyBasket::BenchRequest*,
+                         ::toyBasket::BenchResponse*,
+                         ::google::protobuf::Closure* done) {
+  controller->SetFailed("Method Echo() not implemented.");
+  done->Run();
+}
+
+void BenchService::Stats(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                         const ::toyBasket::StatsRequest*,
+                         ::toyBasket::StatsResponse*,
+                         ::google::protobuf::Closure* done) {
+  controller->SetFailed("Method Stats() not implemented.");
+  done->Run();
+}
+
+void BenchService::CallMethod(const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method,
+                             ::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                             const ::PROTOBUF_NAMESPACE_ID::Message* request,
+                             ::PROTOBUF_NAMESPACE_ID::Message* response,
+                             ::google::protobuf::Closure* done) {
+  GOOGLE_DCHECK_EQ(method->service(), file_level_service_descriptors_rpc_5fbench_2eproto[0]);
+  switch(method->index()) {
+    case 0:
+      Echo(controller,
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<const ::toyBasket::BenchRequest*>(
+                 request),
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<::toyBasket::BenchResponse*>(
+                 response),
+             done);
+      break;
+    case 1:
+      Stats(controller,
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<const ::toyBasket::StatsRequest*>(
+                 request),
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<::toyBasket::StatsResponse*>(
+                 response),
+             done);
+      break;
+    default:
+      GOOGLE_LOG(FATAL) << "Bad method index; this should never happen.";
+      break;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message& BenchService::GetRequestPrototype(
+    const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method) const {
+  GOOGLE_DCHECK_EQ(method->service(), descriptor());
+  switch(method->index()) {
+    case 0:
+      return ::toyBasket::BenchRequest::default_instance();
+    case 1:
+      return ::toyBasket::StatsRequest::default_instance();
+    default:
+      GOOGLE_LOG(FATAL) << "Bad method index; this should never happen.";
+      return *::PROTOBUF_NAMESPACE_ID::MessageFactory::generated_factory()
+          ->GetPrototype(method->input_type());
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message& BenchService::GetResponsePrototype(
+    const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method) const {
+  GOOGLE_DCHECK_EQ(method->service(), descriptor());
+  switch(method->index()) {
+    case 0:
+      return ::toyBasket::BenchResponse::default_instance();
+    case 1:
+      return ::toyBasket::StatsResponse::default_instance();
+    default:
+      GOOGLE_LOG(FATAL) << "Bad method index; this should never happen.";
+      return *::PROTOBUF_NAMESPACE_ID::MessageFactory::generated_factory()
+          ->GetPrototype(method->output_type());
+  }
+}
+
+BenchService_Stub::BenchService_Stub(::PROTOBUF_NAMESPACE_ID::RpcChannel* channel)
+  : channel_(channel), owns_channel_(false) {}
+BenchService_Stub::BenchService_Stub(
+    ::PROTOBUF_NAMESPACE_ID::RpcChannel* channel,
+    ::PROTOBUF_NAMESPACE_ID::Service::ChannelOwnership ownership)
+  : channel_(channel),
+    owns_channel_(ownership == ::PROTOBUF_NAMESPACE_ID::Service::STUB_OWNS_CHANNEL) {}
+BenchService_Stub::~BenchService_Stub() {
+  if (owns_channel_) delete channel_;
+}
+
+void BenchService_Stub::Echo(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                              const ::toyBasket::BenchRequest* request,
+                              ::toyBasket::BenchResponse* response,
+                              ::google::protobuf::Closure* done) {
+  channel_->CallMethod(descriptor()->method(0),
+                       controller, request, response, done);
+}
+void BenchService_Stub::Stats(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                              const ::toyBasket::StatsRequest* request,
+                              ::toyBasket::StatsResponse* response,
+                              ::google::protobuf::Closure* done) {
+  channel_->CallMethod(descriptor()->method(1),
+                       controller, request, response, done);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace toyBasket
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::toyBasket::BenchRequest*
+Arena::CreateMaybeMessage< ::toyBasket::BenchRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::toyBasket::BenchRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::toyBasket::BenchResponse*
+Arena::CreateMaybeMessage< ::toyBasket::BenchResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::toyBasket::BenchResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::toyBasket::StatsRequest*
+Arena::CreateMaybeMessage< ::toyBasket::StatsRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::toyBasket::StatsRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::toyBasket::StatsResponse*
+Arena::CreateMaybeMessage< ::toyBasket::StatsResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::toyBasket::StatsResponse >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,963 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: rpc_bench.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_rpc_5fbench_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_rpc_5fbench_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_bases.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/service.h>
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_rpc_5fbench_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_rpc_5fbench_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_rpc_5fbench_2eproto;
+namespace toyBasket {
+class BenchRequest;
+struct BenchRequestDefaultTypeInternal;
+extern BenchRequestDefaultTypeInternal _BenchRequest_default_instance_;
+class BenchResponse;
+struct BenchResponseDefaultTypeInternal;
+extern BenchResponseDefaultTypeInternal _BenchResponse_default_instance_;
+class StatsRequest;
+struct StatsRequestDefaultTypeInternal;
+extern StatsRequestDefaultTypeInternal _StatsRequest_default_instance_;
+class StatsResponse;
+struct StatsResponseDefaultTypeInternal;
+extern StatsResponseDefaultTypeInternal _StatsResponse_default_instance_;
+}  // namespace toyBasket
+PROTOBUF_NAMESPACE_OPEN
+template<> ::toyBasket::BenchRequest* Arena::CreateMaybeMessage<::toyBasket::BenchRequest>(Arena*);
+template<> ::toyBasket::BenchResponse* Arena::CreateMaybeMessage<::toyBasket::BenchResponse>(Arena*);
+template<> ::toyBasket::StatsRequest* Arena::CreateMaybeMessage<::toyBasket::StatsRequest>(Arena*);
+template<> ::toyBasket::StatsResponse* Arena::CreateMaybeMessage<::toyBasket::StatsResponse>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace toyBasket {
+
+// ===================================================================
+
+class BenchRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:toyBasket.BenchRequest) */ {
+ public:
+  inline BenchRequest() : BenchRequest(nullptr) {}
+  ~BenchRequest() override;
+  explicit PROTOBUF_CONSTEXPR BenchRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  BenchRequest(const BenchRequest& from);
+  BenchRequest(BenchRequest&& from) noexcept
+    : BenchRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline BenchRequest& operator=(const BenchRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BenchRequest& operator=(BenchRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BenchRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BenchRequest* internal_default_instance() {
+    return reinterpret_cast<const BenchRequest*>(
+               &_BenchRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(BenchRequest& a, BenchRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BenchRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BenchRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  BenchRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BenchRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BenchRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BenchRequest& from) {
+    BenchRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BenchRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "toyBasket.BenchRequest";
+  }
+  protected:
+  explicit BenchRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPayloadFieldNumber = 1,
+    kResponseSizeFieldNumber = 2,
+  };
+  // bytes payload = 1;
+  void clear_payload();
+  const std::string& payload() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_payload(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_payload();
+  PROTOBUF_NODISCARD std::string* release_payload();
+  void set_allocated_payload(std::string* payload);
+  private:
+  const std::string& _internal_payload() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_payload(const std::string& value);
+  std::string* _internal_mutable_payload();
+  public:
+
+  // uint32 response_size = 2;
+  void clear_response_size();
+  uint32_t response_size() const;
+  void set_response_size(uint32_t value);
+  private:
+  uint32_t _internal_response_size() const;
+  void _internal_set_response_size(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:toyBasket.BenchRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr payload_;
+    uint32_t response_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_rpc_5fbench_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BenchResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:toyBasket.BenchResponse) */ {
+ public:
+  inline BenchResponse() : BenchResponse(nullptr) {}
+  ~BenchResponse() override;
+  explicit PROTOBUF_CONSTEXPR BenchResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  BenchResponse(const BenchResponse& from);
+  BenchResponse(BenchResponse&& from) noexcept
+    : BenchResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline BenchResponse& operator=(const BenchResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BenchResponse& operator=(BenchResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BenchResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BenchResponse* internal_default_instance() {
+    return reinterpret_cast<const BenchResponse*>(
+               &_BenchResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(BenchResponse& a, BenchResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BenchResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BenchResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  BenchResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BenchResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BenchResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BenchResponse& from) {
+    BenchResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BenchResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "toyBasket.BenchResponse";
+  }
+  protected:
+  explicit BenchResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPayloadFieldNumber = 1,
+  };
+  // bytes payload = 1;
+  void clear_payload();
+  const std::string& payload() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_payload(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_payload();
+  PROTOBUF_NODISCARD std::string* release_payload();
+  void set_allocated_payload(std::string* payload);
+  private:
+  const std::string& _internal_payload() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_payload(const std::string& value);
+  std::string* _internal_mutable_payload();
+  public:
+
+  // @@protoc_insertion_point(class_scope:toyBasket.BenchResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr payload_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_rpc_5fbench_2eproto;
+};
+// -------------------------------------------------------------------
+
+class StatsRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:toyBasket.StatsRequest) */ {
+ public:
+  inline StatsRequest() : StatsRequest(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR StatsRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StatsRequest(const StatsRequest& from);
+  StatsRequest(StatsRequest&& from) noexcept
+    : StatsRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline StatsRequest& operator=(const StatsRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StatsRequest& operator=(StatsRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StatsRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StatsRequest* internal_default_instance() {
+    return reinterpret_cast<const StatsRequest*>(
+               &_StatsRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(StatsRequest& a, StatsRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StatsRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StatsRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StatsRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StatsRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const StatsRequest& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const StatsRequest& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "toyBasket.StatsRequest";
+  }
+  protected:
+  explicit StatsRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:toyBasket.StatsRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_rpc_5fbench_2eproto;
+};
+// -------------------------------------------------------------------
+
+class StatsResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:toyBasket.StatsResponse) */ {
+ public:
+  inline StatsResponse() : StatsResponse(nullptr) {}
+  ~StatsResponse() override;
+  explicit PROTOBUF_CONSTEXPR StatsResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StatsResponse(const StatsResponse& from);
+  StatsResponse(StatsResponse&& from) noexcept
+    : StatsResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline StatsResponse& operator=(const StatsResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StatsResponse& operator=(StatsResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StatsResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StatsResponse* internal_default_instance() {
+    return reinterpret_cast<const StatsResponse*>(
+               &_StatsResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(StatsResponse& a, StatsResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StatsResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StatsResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StatsResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StatsResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const StatsResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StatsResponse& from) {
+    StatsResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StatsResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "toyBasket.StatsResponse";
+  }
+  protected:
+  explicit StatsResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCallsFieldNumber = 1,
+    kUserCpuUsFieldNumber = 2,
+    kSystemCpuUsFieldNumber = 3,
+  };
+  // uint64 calls = 1;
+  void clear_calls();
+  uint64_t calls() const;
+  void set_calls(uint64_t value);
+  private:
+  uint64_t _internal_calls() const;
+  void _internal_set_calls(uint64_t value);
+  public:
+
+  // uint64 user_cpu_us = 2;
+  void clear_user_cpu_us();
+  uint64_t user_cpu_us() const;
+  void set_user_cpu_us(uint64_t value);
+  private:
+  uint64_t _internal_user_cpu_us() const;
+  void _internal_set_user_cpu_us(uint64_t value);
+  public:
+
+  // uint64 system_cpu_us = 3;
+  void clear_system_cpu_us();
+  uint64_t system_cpu_us() const;
+  void set_system_cpu_us(uint64_t value);
+  private:
+  uint64_t _internal_system_cpu_us() const;
+  void _internal_set_system_cpu_us(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:toyBasket.StatsResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t calls_;
+    uint64_t user_cpu_us_;
+    uint64_t system_cpu_us_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_rpc_5fbench_2eproto;
+};
+// ===================================================================
+
+class BenchService_Stub;
+
+class BenchService : public ::PROTOBUF_NAMESPACE_ID::Service {
+ protected:
+  // This class should be treated as an abstract interface.
+  inline BenchService() {};
+ public:
+  virtual ~BenchService();
+
+  typedef BenchService_Stub Stub;
+
+  static const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* descriptor();
+
+  virtual void Echo(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::toyBasket::BenchRequest* request,
+                       ::toyBasket::BenchResponse* response,
+                       ::google::protobuf::Closure* done);
+  virtual void Stats(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::toyBasket::StatsRequest* request,
+                       ::toyBasket::StatsResponse* response,
+                       ::google::protobuf::Closure* done);
+
+  // implements Service ----------------------------------------------
+
+  const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* GetDescriptor();
+  void CallMethod(const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method,
+                  ::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                  const ::PROTOBUF_NAMESPACE_ID::Message* request,
+                  ::PROTOBUF_NAMESPACE_ID::Message* response,
+                  ::google::protobuf::Closure* done);
+  const ::PROTOBUF_NAMESPACE_ID::Message& GetRequestPrototype(
+    const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method) const;
+  const ::PROTOBUF_NAMESPACE_ID::Message& GetResponsePrototype(
+    const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method) const;
+
+ private:
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(BenchService);
+};
+
+class BenchService_Stub : public BenchService {
+ public:
+  BenchService_Stub(::PROTOBUF_NAMESPACE_ID::RpcChannel* channel);
+  BenchService_Stub(::PROTOBUF_NAMESPACE_ID::RpcChannel* channel,
+                   ::PROTOBUF_NAMESPACE_ID::Service::ChannelOwnership ownership);
+  ~BenchService_Stub();
+
+  inline ::PROTOBUF_NAMESPACE_ID::RpcChannel* channel() { return channel_; }
+
+  // implements BenchService ------------------------------------------
+
+  void Echo(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::toyBasket::BenchRequest* request,
+                       ::toyBasket::BenchResponse* response,
+                       ::google::protobuf::Closure* done);
+  void Stats(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::toyBasket::StatsRequest* request,
+                       ::toyBasket::StatsResponse* response,
+                       ::google::protobuf::Closure* done);
+ private:
+  ::PROTOBUF_NAMESPACE_ID::RpcChannel* channel_;
+  bool owns_channel_;
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(BenchService_Stub);
+};
+
+
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// BenchRequest
+
+// bytes payload = 1;
+inline void BenchRequest::clear_payload() {
+  _impl_.payload_.ClearToEmpty();
+}
+inline const std::string& BenchRequest::payload() const {
+  // @@protoc_insertion_point(field_get:toyBasket.BenchRequest.payload)
+  return _internal_payload();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void BenchRequest::set_payload(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.payload_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:toyBasket.BenchRequest.payload)
+}
+inline std::string* BenchRequest::mutable_payload() {
+  std::string* _s = _internal_mutable_payload();
+  // @@protoc_insertion_point(field_mutable:toyBasket.BenchRequest.payload)
+  return _s;
+}
+inline const std::string& BenchRequest::_internal_payload() const {
+  return _impl_.payload_.Get();
+}
+inline void BenchRequest::_internal_set_payload(const std::string& value) {
+  
+  _impl_.payload_.Set(value, GetArenaForAllocation());
+}
+inline std::string* BenchRequest::_internal_mutable_payload() {
+  
+  return _impl_.payload_.Mutable(GetArenaForAllocation());
+}
+inline std::string* BenchRequest::release_payload() {
+  // @@protoc_insertion_point(field_release:toyBasket.BenchRequest.payload)
+  return _impl_.payload_.Release();
+}
+inline void BenchRequest::set_allocated_payload(std::string* payload) {
+  if (payload != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.payload_.SetAllocated(payload, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.payload_.IsDefault()) {
+    _impl_.payload_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:toyBasket.BenchRequest.payload)
+}
+
+// uint32 response_size = 2;
+inline void BenchRequest::clear_response_size() {
+  _impl_.response_size_ = 0u;
+}
+inline uint32_t BenchRequest::_internal_response_size() const {
+  return _impl_.response_size_;
+}
+inline uint32_t BenchRequest::response_size() const {
+  // @@protoc_insertion_point(field_get:toyBasket.BenchRequest.response_size)
+  return _internal_response_size();
+}
+inline void BenchRequest::_internal_set_response_size(uint32_t value) {
+  
+  _impl_.response_size_ = value;
+}
+inline void BenchRequest::set_response_size(uint32_t value) {
+  _internal_set_response_size(value);
+  // @@protoc_insertion_point(field_set:toyBasket.BenchRequest.response_size)
+}
+
+// -------------------------------------------------------------------
+
+// BenchResponse
+
+// bytes payload = 1;
+inline void BenchResponse::clear_payload() {
+  _impl_.payload_.ClearToEmpty();
+}
+inline const std::string& BenchResponse::payload() const {
+  // @@protoc_insertion_point(field_get:toyBasket.BenchResponse.payload)
+  return _internal_payload();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void BenchResponse::set_payload(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.payload_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:toyBasket.BenchResponse.payload)
+}
+inline std::string* BenchResponse::mutable_payload() {
+  std::string* _s = _internal_mutable_payload();
+  // @@protoc_insertion_point(field_mutable:toyBasket.BenchResponse.payload)
+  return _s;
+}
+inline const std::string& BenchResponse::_internal_payload() const {
+  return _impl_.payload_.Get();
+}
+inline void BenchResponse::_internal_set_payload(const std::string& value) {
+  
+  _impl_.payload_.Set(value, GetArenaForAllocation());
+}
+inline std::string* BenchResponse::_internal_mutable_payload() {
+  
+  return _impl_.payload_.Mutable(GetArenaForAllocation());
+}
+inline std::string* BenchResponse::release_payload() {
+  // @@protoc_insertion_point(field_release:toyBasket.BenchResponse.payload)
+  return _impl_.payload_.Release();
+}
+inline void BenchResponse::set_allocated_payload(std::string* payload) {
+  if (payload != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.payload_.SetAllocated(payload, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.payload_.IsDefault()) {
+    _impl_.payload_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:toyBasket.BenchResponse.payload)
+}
+
+// -------------------------------------------------------------------
+
+// StatsRequest
+
+// -------------------------------------------------------------------
+
+// StatsResponse
+
+// uint64 calls = 1;
+inline void StatsResponse::clear_calls() {
+  _impl_.calls_ = uint64_t{0u};
+}
+inline uint64_t StatsResponse::_internal_calls() const {
+  return _impl_.calls_;
+}
+inline uint64_t StatsResponse::calls() const {
+  // @@protoc_insertion_point(field_get:toyBasket.StatsResponse.calls)
+  return _internal_calls();
+}
+inline void StatsResponse::_internal_set_calls(uint64_t value) {
+  
+  _impl_.calls_ = value;
+}
+inline void StatsResponse::set_calls(uint64_t value) {
+  _internal_set_calls(value);
+  // @@protoc_insertion_point(field_set:toyBasket.StatsResponse.calls)
+}
+
+// uint64 user_cpu_us = 2;
+inline void StatsResponse::clear_user_cpu_us() {
+  _impl_.user_cpu_us_ = uint64_t{0u};
+}
+inline uint64_t StatsResponse::_internal_user_cpu_us() const {
+  return _impl_.user_cpu_us_;
+}
+inline uint64_t StatsResponse::user_cpu_us() const {
+  // @@protoc_insertion_point(field_get:toyBasket.StatsResponse.user_cpu_us)
+  return _internal_user_cpu_us();
+}
+inline void StatsResponse::_internal_set_user_cpu_us(uint64_t value) {
+  
+  _impl_.user_cpu_us_ = value;
+}
+inline void StatsResponse::set_user_cpu_us(uint64_t value) {
+  _internal_set_user_cpu_us(value);
+  // @@protoc_insertion_point(field_set:toyBasket.StatsResponse.user_cpu_us)
+}
+
+// uint64 system_cpu_us = 3;
+inline void StatsResponse::clear_system_cpu_us() {
+  _impl_.system_cpu_us_ = uint64_t{0u};
+}
+inline uint64_t StatsResponse::_internal_system_cpu_us() const {
+  return _impl_.system_cpu_us_;
+}
+inline uint64_t StatsResponse::system_cpu_us() const {
+  // @@protoc_insertion_point(field_get:toyBasket.StatsResponse.system_cpu_us)
+  return _internal_system_cpu_us();
+}
+inline void StatsResponse::_internal_set_system_cpu_us(uint64_t value) {
+  
+  _impl_.system_cpu_us_ = value;
+}
+inline void StatsResponse::set_system_cpu_us(uint64_t value) {
+  _internal_set_system_cpu_us(value);
+  // @@protoc_insertion_point(field_set:toyBasket.StatsResponse.system_cpu_us)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace toyBasket
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_rpc_5fbench_2eproto
@@ -0,0 +1,552 @@
+#include "EventLoop.h"
+#include "InetAddress.h"
+#include "TaskEventLoopThread.h"
+#include "rpc_bench.pb.h"
+#include "rpc_channel.h"
+#include "rpc_controller.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <sys/resource.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+using namespace toyBasket;
+
+void print_usage() {
+  std::cout << "Use: rpc_bench_client [options]" << std::endl;
+  std::cout << "  -a ip         server address, default 127.0.0.1" << std::endl;
+  std::cout << "  -p port       server port, default 12322" << std::endl;
+  std::cout << "  -t threads    client threads, each with its own loop and "
+               "channel, default 1"
+            << std::endl;
+  std::cout << "  -c conns      connections per thread, default 1" << std::endl;
+  std::cout << "  -d depth      calls in flight per connection, default 1"
+            << std::endl;
+  std::cout << "  -s sizes      request payload sizes, comma separated, one "
+               "run each, default 64"
+            << std::endl;
+  std::cout << "  -r bytes      response payload size, default 0 (echo the "
+               "request)"
+            << std::endl;
+  std::cout << "  -D seconds    measured duration of each run, default 10"
+            << std::endl;
+  std::cout << "  -W seconds    warmup before each run, default 2" << std::endl;
+  std::cout << "  -T ms         call timeout, 0 for none, default 10000"
+            << std::endl;
+  std::cout << "  -z bytes      compress requests from this size, default 0 "
+               "(off)"
+            << std::endl;
+  std::cout << "  -F            no fixed binary header" << std::endl;
+  std::cout << "  -C            no write coalescing" << std::endl;
+  std::cout << "  -j            one JSON object per run instead of text"
+            << std::endl;
+  std::cout << "for example: rpc_bench_client -t 4 -c 2 -d 16 -s 64,1024,16384"
+            << std::endl;
+}
+
+struct Options {
+  std::string ip = "127.0.0.1";
+  uint16_t port = 12322;
+  int threads = 1;
+  int connections = 1;
+  int depth = 1;
+  std::vector<size_t> sizes;
+  uint32_t response_size = 0;
+  double duration = 10.0;
+  double warmup = 2.0;
+  int64_t timeout_ms = RpcChannel::kDefaultTimeoutMs;
+  size_t compress_threshold = 0;
+  bool fixed_header = true;
+  bool write_coalescing = true;
+  bool json = false;
+};
+
+// log-linear buckets over nanoseconds: exact below 64ns, then 64 buckets per
+// power of two, so every reported value is within 1/64 of the real one
+class LatencyHistogram {
+public:
+  static const int kSubBits = 6;
+  static const uint64_t kSubCount = 1 << kSubBits;
+
+  LatencyHistogram() : buckets_((64 - kSubBits + 1) * kSubCount) { reset(); }
+
+  void reset() {
+    std::fill(buckets_.begin(), buckets_.end(), 0);
+    count_ = 0;
+    sum_ = 0;
+    max_ = 0;
+  }
+
+  void record(uint64_t ns) {
+    ++buckets_[index(ns)];
+    ++count_;
+    sum_ += ns;
+    if (ns > max_) {
+      max_ = ns;
+    }
+  }
+
+  void merge(const LatencyHistogram &other) {
+    for (size_t i = 0; i < buckets_.size(); ++i) {
+      buckets_[i] += other.buckets_[i];
+    }
+    count_ += other.count_;
+    sum_ += other.sum_;
+    if (other.max_ > max_) {
+      max_ = other.max_;
+    }
+  }
+
+  uint64_t count() const { return count_; }
+  double mean() const {
+    return count_ == 0 ? 0.0
+                       : static_cast<double>(sum_) /
+                             static_cast<double>(count_);
+  }
+  uint64_t max() const { return max_; }
+
+  // the highest value in the bucket holding the q-th quantile, q in [0, 1]
+  uint64_t percentile(double q) const {
+    if (count_ == 0) {
+      return 0;
+    }
+    uint64_t rank =
+        static_cast<uint64_t>(q * static_cast<double>(count_) + 0.5);
+    if (rank == 0) {
+      rank = 1;
+    }
+    uint64_t seen = 0;
+    for (size_t i = 0; i < buckets_.size(); ++i) {
+      seen += buckets_[i];
+      if (seen >= rank) {
+        return std::min(upperBound(i), max_);
+      }
+    }
+    return max_;
+  }
+
+private:
+  static size_t index(uint64_t ns) {
+    if (ns < kSubCount) {
+      return static_cast<size_t>(ns);
+    }
+    int exponent = 63 - __builtin_clzll(ns);
+    int shift = exponent - kSubBits;
+    return static_cast<size_t>((shift + 1) * kSubCount +
+                               ((ns >> shift) - kSubCount));
+  }
+
+  static uint64_t upperBound(size_t index) {
+    if (index < kSubCount) {
+      return index;
+    }
+    uint64_t shift = index / kSubCount - 1;
+    uint64_t sub = index % kSubCount;
+    return ((kSubCount + sub + 1) << shift) - 1;
+  }
+
+  std::vector<uint64_t> buckets_;
+  uint64_t count_;
+  uint64_t sum_;
+  uint64_t max_;
+};
+
+// runs f in the loop thread and waits for it
+void runInLoopSync(EventLoop *loop, const std::function<void()> &f) {
+  std::promise<void> finished;
+  loop->runInLoop([&] {
+    f();
+    finished.set_value();
+  });
+  finished.get_future().wait();
+}
+
+// the connections of a destroyed channel close in the next loop iteration and
+// are released in the one after, wait for both before the loop is stopped
+void destroyChannel(EventLoop *loop, std::unique_ptr<RpcChannel> *channel) {
+  runInLoopSync(loop, [channel] { channel->reset(); });
+  runInLoopSync(loop, [] {});
+  runInLoopSync(loop, [] {});
+}
+
+void setFinished(std::promise<void> *finished) { finished->set_value(); }
+
+uint64_t processCpuUs() {
+  struct rusage usage;
+  ::getrusage(RUSAGE_SELF, &usage);
+  return static_cast<uint64_t>(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) *
+             1000000 +
+         static_cast<uint64_t>(usage.ru_utime.tv_usec + usage.ru_stime.tv_usec);
+}
+
+enum Phase {
+  kWarmup, // calls are issued but not recorded
+  kRecord, // completed calls are recorded
+  kDrain,  // no new calls, in-flight calls finish
+};
+
+// one client thread: an EventLoop, an RpcChannel with `connections`
+// connections and connections * depth calls always in flight
+class BenchWorker {
+public:
+  BenchWorker(const Options &options, const std::atomic<int> *phase)
+      : loop_(thread_.startLoop()), phase_(phase), errors_(0),
+        outstanding_(0) {
+    std::vector<InetAddress> endpoints(1,
+                                       InetAddress(options.ip, options.port));
+    runInLoopSync(loop_, [&] {
+      channel_.reset(
+          new RpcChannel(loop_, endpoints, options.connections));
+      channel_->SetDefaultTimeout(options.timeout_ms);
+      channel_->SetFixedHeader(options.fixed_header);
+      channel_->SetWriteCoalescing(options.write_coalescing);
+      channel_->SetCompressThreshold(options.compress_threshold);
+      channel_->connect();
+    });
+    stub_.reset(new toyBasket::BenchService_Stub(channel_.get()));
+    for (int i = 0; i < options.connections * options.depth; ++i) {
+      std::unique_ptr<Slot> slot(new Slot);
+      slot->request.set_response_size(options.response_size);
+      slot->done = ::google::protobuf::NewPermanentCallback(
+          this, &BenchWorker::onDone, slot.get());
+      slots_.push_back(std::move(slot));
+    }
+  }
+
+  ~BenchWorker() {
+    destroyChannel(loop_, &channel_);
+    for (auto &slot : slots_) {
+      delete slot->done;
+    }
+  }
+
+  // keeps every slot busy until the phase becomes kDrain
+  void start(const std::string &payload) {
+    histogram_.reset();
+    errors_ = 0;
+    outstanding_ = static_cast<int>(slots_.size());
+    for (auto &slot : slots_) {
+      slot->request.set_payload(payload);
+    }
+    loop_->runInLoop([this] {
+      for (auto &slot : slots_) {
+        issue(slot.get());
+      }
+    });
+  }
+
+  // after this the histogram and the error count are stable
+  void waitDrained() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    drained_.wait(lock, [this] { return outstanding_ == 0; });
+  }
+
+  const LatencyHistogram &histogram() const { return histogram_; }
+  uint64_t errors() const { return errors_; }
+
+private:
+  struct Slot {
+    toyBasket::RpcController controller;
+    toyBasket::BenchRequest request;
+    toyBasket::BenchResponse response;
+    ::google::protobuf::Closure *done;
+    TimePoint start;
+  };
+
+  void issue(Slot *slot) {
+    slot->controller.Reset();
+    slot->start = Clock::now();
+    stub_->Echo(&slot->controller, &slot->request, &slot->response,
+                slot->done);
+  }
+
+  void onDone(Slot *slot) {
+    int phase = phase_->load(std::memory_order_acquire);
+    bool failed = slot->controller.Failed();
+    if (phase == kRecord) {
+      if (failed) {
+        ++errors_;
+      } else {
+        histogram_.record(static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                Clock::now() - slot->start)
+                .count()));
+      }
+    }
+    if (phase == kDrain) {
+      std::unique_lock<std::mutex> lock(mutex_);
+      if (--outstanding_ == 0) {
+        drained_.notify_all();
+      }
+    } else if (failed) {
+      // not connected yet or the server is gone, do not spin
+      loop_->runAfter(0.01, [this, slot] { issue(slot); });
+    } else {
+      issue(slot);
+    }
+  }
+
+  TaskEventLoopThread thread_;
+  EventLoop *loop_;
+  const std::atomic<int> *phase_;
+  std::unique_ptr<RpcChannel> channel_;
+  std::unique_ptr<toyBasket::BenchService_Stub> stub_;
+  std::vector<std::unique_ptr<Slot>> slots_;
+  LatencyHistogram histogram_;
+  uint64_t errors_;
+  std::mutex mutex_;
+  std::condition_variable drained_;
+  int outstanding_;
+};
+
+// asks the server for its call count and cpu time on a separate connection
+class StatsClient {
+public:
+  explicit StatsClient(const Options &options) : loop_(thread_.startLoop()) {
+    InetAddress server(options.ip, options.port);
+    runInLoopSync(loop_, [&] {
+      channel_.reset(new RpcChannel(loop_, server));
+      channel_->connect();
+    });
+    stub_.reset(new toyBasket::BenchService_Stub(channel_.get()));
+  }
+
+  ~StatsClient() { destroyChannel(loop_, &channel_); }
+
+  // retries while the connection is being set up, false after timeout_s
+  bool fetch(toyBasket::StatsResponse *stats, double timeout_s) {
+    TimePoint deadline =
+        Clock::now() + std::chrono::milliseconds(
+                           static_cast<int64_t>(timeout_s * 1000));
+    for (;;) {
+      toyBasket::RpcController controller;
+      toyBasket::StatsRequest request;
+      std::promise<void> finished;
+      loop_->runInLoop([&] {
+        stub_->Stats(&controller, &request, stats,
+                     ::google::protobuf::NewCallback(&setFinished, &finished));
+      });
+      finished.get_future().wait();
+      if (!controller.Failed()) {
+        return true;
+      }
+      if (Clock::now() > deadline) {
+        return false;
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+  }
+
+private:
+  TaskEventLoopThread thread_;
+  EventLoop *loop_;
+  std::unique_ptr<RpcChannel> channel_;
+  std::unique_ptr<toyBasket::BenchService_Stub> stub_;
+};
+
+struct Result {
+  size_t payload;
+  double seconds;
+  uint64_t calls;
+  uint64_t errors;
+  LatencyHistogram histogram;
+  uint64_t client_cpu_us;
+  uint64_t server_cpu_us;
+  uint64_t server_calls;
+};
+
+void printResult(const Options &options, const Result &result) {
+  double calls = static_cast<double>(result.calls);
+  double qps = calls / result.seconds;
+  double client_cpu = result.calls == 0
+                          ? 0.0
+                          : static_cast<double>(result.client_cpu_us) / calls;
+  double server_cpu = result.calls == 0
+                          ? 0.0
+                          : static_cast<double>(result.server_cpu_us) / calls;
+  const LatencyHistogram &h = result.histogram;
+  char buf[1024];
+  if (options.json) {
+    snprintf(buf, sizeof buf,
+             "{\"payload\":%zu,\"response\":%u,\"threads\":%d,"
+             "\"connections\":%d,\"depth\":%d,\"seconds\":%.3f,"
+             "\"calls\":%llu,\"errors\":%llu,\"qps\":%.1f,"
+             "\"latency_us\":{\"mean\":%.2f,\"p50\":%.2f,\"p90\":%.2f,"
+             "\"p99\":%.2f,\"p999\":%.2f,\"max\":%.2f},"
+             "\"client_cpu_us_per_call\":%.3f,"
+             "\"server_cpu_us_per_call\":%.3f,\"server_calls\":%llu}",
+             result.payload, options.response_size, options.threads,
+             options.connections, options.depth, result.seconds,
+             static_cast<unsigned long long>(result.calls),
+             static_cast<unsigned long long>(result.errors), qps,
+             h.mean() / 1000, static_cast<double>(h.percentile(0.5)) / 1000,
+             static_cast<double>(h.percentile(0.9)) / 1000,
+             static_cast<double>(h.percentile(0.99)) / 1000,
+             static_cast<double>(h.percentile(0.999)) / 1000,
+             static_cast<double>(h.max()) / 1000, client_cpu, server_cpu,
+             static_cast<unsigned long long>(result.server_calls));
+  } else {
+    snprintf(buf, sizeof buf,
+             "payload %zu bytes, %d threads x %d connections x depth %d\n"
+             "  calls %llu in %.2f s, qps %.1f, errors %llu\n"
+             "  latency us: mean %.2f p50 %.2f p90 %.2f p99 %.2f p999 %.2f "
+             "max %.2f\n"
+             "  cpu us per call: client %.3f server %.3f",
+             result.payload, options.threads, options.connections,
+             options.depth, static_cast<unsigned long long>(result.calls),
+             result.seconds, qps,
+             static_cast<unsigned long long>(result.errors), h.mean() / 1000,
+             static_cast<double>(h.percentile(0.5)) / 1000,
+             static_cast<double>(h.percentile(0.9)) / 1000,
+             static_cast<double>(h.percentile(0.99)) / 1000,
+             static_cast<double>(h.percentile(0.999)) / 1000,
+             static_cast<double>(h.max()) / 1000, client_cpu, server_cpu);
+  }
+  std::cout << buf << std::endl;
+}
+
+bool parseSizes(const char *arg, std::vector<size_t> *sizes) {
+  std::stringstream ss(arg);
+  std::string item;
+  while (std::getline(ss, item, ',')) {
+    char *end;
+    unsigned long size = strtoul(item.c_str(), &end, 10);
+    if (item.empty() || *end != '\0') {
+      return false;
+    }
+    sizes->push_back(size);
+  }
+  return !sizes->empty();
+}
+
+int main(int argc, char *argv[]) {
+  Options options;
+  int opt;
+  while ((opt = ::getopt(argc, argv, "a:p:t:c:d:s:r:D:W:T:z:FCjh")) != -1) {
+    switch (opt) {
+    case 'a':
+      options.ip = optarg;
+      break;
+    case 'p':
+      options.port = static_cast<uint16_t>(atoi(optarg));
+      break;
+    case 't':
+      options.threads = atoi(optarg);
+      break;
+    case 'c':
+      options.connections = atoi(optarg);
+      break;
+    case 'd':
+      options.depth = atoi(optarg);
+      break;
+    case 's':
+      if (!parseSizes(optarg, &options.sizes)) {
+        print_usage();
+        return -1;
+      }
+      break;
+    case 'r':
+      options.response_size = static_cast<uint32_t>(atol(optarg));
+      break;
+    case 'D':
+      options.duration = atof(optarg);
+      break;
+    case 'W':
+      options.warmup = atof(optarg);
+      break;
+    case 'T':
+      options.timeout_ms = atol(optarg);
+      break;
+    case 'z':
+      options.compress_threshold = static_cast<size_t>(atol(optarg));
+      break;
+    case 'F':
+      options.fixed_header = false;
+      break;
+    case 'C':
+      options.write_coalescing = false;
+      break;
+    case 'j':
+      options.json = true;
+      break;
+    default:
+      print_usage();
+      return -1;
+    }
+  }
+  if (options.sizes.empty()) {
+    options.sizes.push_back(64);
+  }
+  if (options.threads < 1 || options.connections < 1 || options.depth < 1 ||
+      options.duration <= 0) {
+    print_usage();
+    return -1;
+  }
+
+  StatsClient stats_client(options);
+  toyBasket::StatsResponse before;
+  if (!stats_client.fetch(&before, 5.0)) {
+    std::cout << "cannot reach rpc_bench_server at " << options.ip << ":"
+              << options.port << std::endl;
+    return -1;
+  }
+
+  std::atomic<int> phase(kDrain);
+  std::vector<std::unique_ptr<BenchWorker>> workers;
+  for (int i = 0; i < options.threads; ++i) {
+    workers.push_back(
+        std::unique_ptr<BenchWorker>(new BenchWorker(options, &phase)));
+  }
+
+  for (size_t payload_size : options.sizes) {
+    std::string payload(payload_size, 'q');
+    phase.store(kWarmup, std::memory_order_release);
+    for (auto &worker : workers) {
+      worker->start(payload);
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(
+        static_cast<int64_t>(options.warmup * 1000)));
+
+    toyBasket::StatsResponse after;
+    stats_client.fetch(&before, 1.0);
+    uint64_t cpu_before = processCpuUs();
+    TimePoint start = Clock::now();
+    phase.store(kRecord, std::memory_order_release);
+    std::this_thread::sleep_for(std::chrono::milliseconds(
+        static_cast<int64_t>(options.duration * 1000)));
+    phase.store(kDrain, std::memory_order_release);
+    TimePoint stop = Clock::now();
+    uint64_t cpu_after = processCpuUs();
+    stats_client.fetch(&after, 1.0);
+
+    Result result;
+    result.payload = payload_size;
+    result.seconds = std::chrono::duration<double>(stop - start).count();
+    result.errors = 0;
+    for (auto &worker : workers) {
+      worker->waitDrained();
+      result.histogram.merge(worker->histogram());
+      result.errors += worker->errors();
+    }
+    result.calls = result.histogram.count();
+    result.client_cpu_us = cpu_after - cpu_before;
+    result.server_cpu_us = after.user_cpu_us() + after.system_cpu_us() -
+                           before.user_cpu_us() - before.system_cpu_us();
+    result.server_calls = after.calls() - before.calls();
+    printResult(options, result);
+  }
+
+  workers.clear();
+  return 0;
+}
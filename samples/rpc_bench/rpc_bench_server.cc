@@ -0,0 +1,140 @@
+#include "EventLoop.h"
+#include "InetAddress.h"
+#include "rpc_bench.pb.h"
+#include "rpc_server.h"
+#include <atomic>
+#include <iostream>
+#include <stdlib.h>
+#include <sys/resource.h>
+#include <unistd.h>
+
+using namespace toyBasket;
+
+void print_usage() {
+  std::cout << "Use: rpc_bench_server [options]" << std::endl;
+  std::cout << "  -a ip         listen address, default 127.0.0.1" << std::endl;
+  std::cout << "  -p port       listen port, default 12322" << std::endl;
+  std::cout << "  -t threads    io threads, default 0 (all in the main loop)"
+            << std::endl;
+  std::cout << "  -w threads    run Echo on a pool of this many worker threads,"
+            << " default 0 (inline)" << std::endl;
+  std::cout << "  -z bytes      compress responses from this size, default 0 "
+               "(off)"
+            << std::endl;
+  std::cout << "  -F            refuse the fixed binary header" << std::endl;
+  std::cout << "  -C            no write coalescing" << std::endl;
+}
+
+class BenchServiceImpl : public toyBasket::BenchService {
+public:
+  BenchServiceImpl() : calls_(0) {}
+  virtual ~BenchServiceImpl() {}
+
+private:
+  virtual void Echo(google::protobuf::RpcController *controller,
+                    const toyBasket::BenchRequest *request,
+                    toyBasket::BenchResponse *response,
+                    google::protobuf::Closure *done) {
+    calls_.fetch_add(1, std::memory_order_relaxed);
+    if (request->response_size() == 0) {
+      response->set_payload(request->payload());
+    } else {
+      response->mutable_payload()->assign(request->response_size(), 'r');
+    }
+    done->Run();
+  }
+  virtual void Stats(google::protobuf::RpcController *controller,
+                     const toyBasket::StatsRequest *request,
+                     toyBasket::StatsResponse *response,
+                     google::protobuf::Closure *done) {
+    struct rusage usage;
+    ::getrusage(RUSAGE_SELF, &usage);
+    response->set_calls(calls_.load(std::memory_order_relaxed));
+    response->set_user_cpu_us(
+        static_cast<uint64_t>(usage.ru_utime.tv_sec) * 1000000 +
+        static_cast<uint64_t>(usage.ru_utime.tv_usec));
+    response->set_system_cpu_us(
+        static_cast<uint64_t>(usage.ru_stime.tv_sec) * 1000000 +
+        static_cast<uint64_t>(usage.ru_stime.tv_usec));
+    done->Run();
+  }
+
+private:
+  std::atomic<uint64_t> calls_;
+};
+
+int main(int argc, char *argv[]) {
+  std::string ip = "127.0.0.1";
+  uint16_t port = 12322;
+  int io_threads = 0;
+  int worker_threads = 0;
+  size_t compress_threshold = 0;
+  bool fixed_header = true;
+  bool write_coalescing = true;
+
+  int opt;
+  while ((opt = ::getopt(argc, argv, "a:p:t:w:z:FCh")) != -1) {
+    switch (opt) {
+    case 'a':
+      ip = optarg;
+      break;
+    case 'p':
+      port = static_cast<uint16_t>(atoi(optarg));
+      break;
+    case 't':
+      io_threads = atoi(optarg);
+      break;
+    case 'w':
+      worker_threads = atoi(optarg);
+      break;
+    case 'z':
+      compress_threshold = static_cast<size_t>(atol(optarg));
+      break;
+    case 'F':
+      fixed_header = false;
+      break;
+    case 'C':
+      write_coalescing = false;
+      break;
+    default:
+      print_usage();
+      return -1;
+    }
+  }
+
+  toyBasket::EventLoop loop;
+  InetAddress server(ip, port);
+  toyBasket::RpcServer rpc_server(&loop, server);
+  rpc_server.SetIoThreadNum(io_threads);
+  rpc_server.SetFixedHeader(fixed_header);
+  rpc_server.SetWriteCoalescing(write_coalescing);
+  rpc_server.SetCompressThreshold(compress_threshold);
+
+  toyBasket::BenchService *bench_service = new BenchServiceImpl();
+  bool registered;
+  if (worker_threads > 0) {
+    rpc_server.SetWorkerThreadNum(worker_threads);
+    registered = rpc_server.RegisterService(bench_service, true,
+                                            RpcServer::kSharedPool);
+    // Stats must not queue behind the measured calls
+    registered = registered &&
+                 rpc_server.SetMethodExecutor(
+                     bench_service->GetDescriptor()->name(), "Stats",
+                     RpcServer::kInline);
+  } else {
+    registered = rpc_server.RegisterService(bench_service, true);
+  }
+  if (!registered) {
+    std::cout << "register service failed" << std::endl;
+    return -1;
+  }
+
+  rpc_server.Start();
+  std::cout << "rpc_bench_server listening on " << ip << ":" << port
+            << ", io threads " << io_threads << ", worker threads "
+            << worker_threads << std::endl;
+
+  loop.loop();
+
+  return 0;
+}
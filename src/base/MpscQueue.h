@@ -0,0 +1,234 @@
+/******************************************************************************
+ * File name     : MpscQueue.h
+ * Description   :
+ * Version       : v1.0
+ * Create Time   : 2026/10/17
+ * Author        : andy
+ * Modify history:
+ *******************************************************************************
+ * Modify Time   Modify person  Modification
+ * ------------------------------------------------------------------------------
+ *
+ *******************************************************************************/
+#ifndef _MPSCQUEUE_H
+#define _MPSCQUEUE_H
+
+#include "noncopyable.h"
+
+#include <assert.h>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace toyBasket
+{
+
+///
+/// Unbounded multi-producer single-consumer queue, after Dmitry Vyukov.
+///
+/// push() takes one exchange on head_ and one store. The value lives in the
+/// node itself, and popped nodes are recycled through per-thread caches that
+/// trade whole batches with a shared depot. Once the queue has warmed up, a
+/// push neither allocates nor locks, apart from one depot lock per batch.
+/// Moving the value in still may allocate, e.g. a large std::function
+/// target. Only one thread may call pop().
+template <typename T>
+class MpscQueue : noncopyable
+{
+public:
+    MpscQueue()
+        : head_(allocNode())
+        , tail_(head_.load(std::memory_order_relaxed))
+        , size_(0)
+    {
+    }
+
+    ~MpscQueue()
+    {
+        T value;
+        while (pop(value))
+        {
+        }
+        freeNode(tail_);
+    }
+
+    void push(T&& x)
+    {
+        Node* node  = allocNode();
+        node->value = std::move(x);
+        // counted before it can be popped, so size() never goes below zero;
+        // seq_cst, see size()
+        size_.fetch_add(1, std::memory_order_seq_cst);
+        // the node is visible to the consumer only after prev->next is set
+        Node* prev = head_.exchange(node, std::memory_order_seq_cst);
+        prev->next.store(node, std::memory_order_release);
+    }
+
+    void push(const T& x)
+    {
+        T copy(x);
+        push(std::move(copy));
+    }
+
+    /// Consumer only. Returns false when the queue is empty.
+    bool pop(T& x)
+    {
+        Node* tail = tail_;
+        Node* next = tail->next.load(std::memory_order_acquire);
+        while (!next)
+        {
+            if (head_.load(std::memory_order_seq_cst) == tail)
+            {
+                return false;
+            }
+            // a producer is between its exchange and its store, it won't be long
+            std::this_thread::yield();
+            next = tail->next.load(std::memory_order_acquire);
+        }
+        x     = std::move(next->value);
+        tail_ = next;
+        freeNode(tail);
+        size_.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    /// Approximate when producers are running.
+    ///
+    /// The count and the load are seq_cst: a consumer that makes a seq_cst
+    /// store and then calls size() sees every push made before a producer's
+    /// later seq_cst operation that came earlier in the total order. The
+    /// EventLoop wakeup flag relies on it.
+    size_t size() const
+    {
+        return size_.load(std::memory_order_seq_cst);
+    }
+
+private:
+    struct Node
+    {
+        Node()
+            : next(nullptr)
+        {
+        }
+        std::atomic<Node*> next;
+        T value;
+    };
+
+    static const size_t kBatch = 64; // nodes moved between a thread and the depot at a time
+
+    /// Spare nodes, linked through next. Shared by all queues of this T, as
+    /// in BufferPool: each thread keeps up to two batches, the rest goes to
+    /// the depot under a lock, one lock per batch.
+    struct NodeList
+    {
+        Node* head;
+        size_t count;
+    };
+
+    struct Depot
+    {
+        std::mutex mutex;
+        std::vector<NodeList> batches;
+    };
+
+    struct NodeCache
+    {
+        NodeCache()
+        {
+            free.head  = nullptr;
+            free.count = 0;
+            spare      = free;
+        }
+
+        ~NodeCache()
+        {
+            // an exiting thread gives its nodes back
+            std::lock_guard<std::mutex> lock(depot().mutex);
+            if (free.head)
+            {
+                depot().batches.push_back(free);
+            }
+            if (spare.head)
+            {
+                depot().batches.push_back(spare);
+            }
+        }
+
+        NodeList free;  // nodes are taken from and given back to this one
+        NodeList spare; // a full batch, or empty
+    };
+
+    static Depot& depot()
+    {
+        // never destroyed, threads may still give nodes back after main returns
+        static Depot* depot = new Depot;
+        return *depot;
+    }
+
+    static NodeCache& nodeCache()
+    {
+        static thread_local NodeCache cache;
+        return cache;
+    }
+
+    static Node* allocNode()
+    {
+        NodeCache& cache = nodeCache();
+        if (!cache.free.head)
+        {
+            if (cache.spare.head)
+            {
+                std::swap(cache.free, cache.spare);
+            }
+            else
+            {
+                Depot& d = depot();
+                std::lock_guard<std::mutex> lock(d.mutex);
+                if (d.batches.empty())
+                {
+                    return new Node;
+                }
+                cache.free = d.batches.back();
+                d.batches.pop_back();
+            }
+        }
+        Node* node      = cache.free.head;
+        cache.free.head = node->next.load(std::memory_order_relaxed);
+        --cache.free.count;
+        node->next.store(nullptr, std::memory_order_relaxed);
+        return node;
+    }
+
+    static void freeNode(Node* node)
+    {
+        // don't keep what the value holds alive until the node is reused
+        node->value      = T();
+        NodeCache& cache = nodeCache();
+        node->next.store(cache.free.head, std::memory_order_relaxed);
+        cache.free.head = node;
+        if (++cache.free.count < kBatch)
+        {
+            return;
+        }
+        // a full batch: kept as the spare, or handed to other threads
+        NodeList batch = cache.free;
+        cache.free.head  = nullptr;
+        cache.free.count = 0;
+        if (!cache.spare.head)
+        {
+            cache.spare = batch;
+            return;
+        }
+        std::lock_guard<std::mutex> lock(depot().mutex);
+        depot().batches.push_back(batch);
+    }
+
+    std::atomic<Node*> head_; // producers
+    Node* tail_;              // consumer, always a stub whose value was taken
+    std::atomic<size_t> size_;
+};
+
+} // namespace toyBasket
+
+#endif // _MPSCQUEUE_H
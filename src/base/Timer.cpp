@@ -12,22 +12,41 @@
  *******************************************************************************/
 #include "Timer.h"
 #include <algorithm>
+#include <climits>
 #include <iostream>
 #include <thread>
 
 using namespace toyBasket;
 
+const unsigned long long TimerManager::kNearSize;
+const unsigned long long TimerManager::kFarSize;
+const unsigned long long TimerManager::kNearMask;
+const unsigned long long TimerManager::kFarMask;
+
+namespace
+{
+const unsigned long long kNoTick = ULLONG_MAX;
+} // namespace
+
 TimerManager::TimerManager()
-    : tick_(std::chrono::milliseconds(1))
-    , isStart_(false)
-    , timeline_(0)
+    : isStart_(false)
+    , epoch_(std::chrono::steady_clock::now())
+    , current_(0)
+    , nextWake_(kNoTick)
     , autoIncrementId_(1)
+    , nearCount_(0)
 {
 }
 
 TimerManager::~TimerManager()
 {
     workStop();
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (auto& item : timers_)
+    {
+        delete item.second;
+    }
+    timers_.clear();
 }
 
 TimerManager* TimerManager::getInstance()
@@ -39,136 +58,281 @@ TimerManager* TimerManager::getInstance()
 unsigned long long TimerManager::addTimer(unsigned int interval, std::function<void()> action, bool isRepeat,
                                           bool isNoDelay, int id)
 {
-    if (isInLoopThread())
-    {
-        Timer event(interval, this->timeline_, std::move(action), isRepeat, isNoDelay);
-        event.m_id = (id != -1) ? static_cast<unsigned long long>(id) : this->autoIncrementId_++;
+    std::unique_lock<std::mutex> lock(mutex_);
+    unsigned long long timerId = (id != -1) ? static_cast<unsigned long long>(id) : this->autoIncrementId_++;
+    deleteTimerLocked(timerId);
 
-        timer_.push_back(event);
-        std::push_heap(timer_.begin(), timer_.end(), std::greater<Timer>());
+    unsigned long long tick = now();
+    Timer* timer     = new Timer(timerId, interval, isNoDelay ? tick : tick + interval, std::move(action), isRepeat);
+    timers_[timerId] = timer;
+    place(timer);
 
-        return event.m_id;
+    // 比工作线程计划的唤醒时间更早, 需要叫醒它重新计算
+    if (std::max(timer->m_deadline, current_) < nextWake_)
+    {
+        nextWake_ = std::max(timer->m_deadline, current_);
+        cond_.notify_one();
     }
-    else
+    return timerId;
+}
+
+void TimerManager::deleteTimer(unsigned long long& timerId)
+{
+    if (timerId < 1)
     {
-        std::unique_lock<std::mutex> lock(mutex_);
-        Timer event(interval, this->timeline_, std::move(action), isRepeat, isNoDelay);
-        event.m_id = (id != -1) ? static_cast<unsigned long long>(id) : this->autoIncrementId_++;
+        return;
+    }
 
-        timer_.push_back(event);
-        std::push_heap(timer_.begin(), timer_.end(), std::greater<Timer>());
+    std::unique_lock<std::mutex> lock(mutex_);
+    deleteTimerLocked(timerId);
+    timerId = 0;
+}
 
-        return event.m_id;
+void TimerManager::deleteTimerLocked(unsigned long long timerId)
+{
+    auto it = timers_.find(timerId);
+    if (it == timers_.end())
+    {
+        return;
+    }
+
+    Timer* timer = it->second;
+    timers_.erase(it);
+    if (timer->m_isRunning)
+    {
+        // 回调正在执行(或等待执行), 由工作线程负责释放
+        timer->m_isCancelled = true;
+    }
+    else
+    {
+        unlink(timer);
+        delete timer;
     }
 }
 
-void TimerManager::deleteTimer(unsigned long long& timerId)
+unsigned long long TimerManager::now() const
 {
-    if (isInLoopThread())
+    return static_cast<unsigned long long>(
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - epoch_).count());
+}
+
+void TimerManager::place(Timer* timer)
+{
+    unsigned long long expires = std::max(timer->m_deadline, current_);
+    unsigned long long delta   = expires - current_;
+
+    if (delta < kNearSize)
     {
-        if (timerId < 1)
+        timer->m_level = 0;
+        timer->m_slot  = expires & kNearMask;
+        ++nearCount_;
+    }
+    else
+    {
+        int level = 0;
+        while (level < kFarLevels - 1 && delta >= (1ULL << (kNearBits + (level + 1) * kFarBits)))
         {
-            return;
+            ++level;
         }
-
-        for (auto it = timer_.begin(); it != timer_.end();)
+        if (delta >= (1ULL << (kNearBits + kFarLevels * kFarBits)))
         {
-            if (it->m_id == timerId)
-            {
-                it = timer_.erase(it);
-                break;
-            }
-            else
-            {
-                ++it;
-            }
+            // 超出时间轮范围, 先挂到最远处, 下放时会重新计算
+            expires = current_ + (1ULL << (kNearBits + kFarLevels * kFarBits)) - 1;
         }
+        timer->m_level = level + 1;
+        timer->m_slot  = (expires >> (kNearBits + level * kFarBits)) & kFarMask;
+    }
+
+    TimerList* list = (timer->m_level == 0) ? &near_[timer->m_slot] : &far_[timer->m_level - 1][timer->m_slot];
+    timer->m_prev = nullptr;
+    timer->m_next = list->head;
+    if (list->head)
+    {
+        list->head->m_prev = timer;
+    }
+    list->head = timer;
+}
 
-        timerId = 0;
-        // 重新调整堆
-        std::make_heap(timer_.begin(), timer_.end(), std::greater<Timer>());
+void TimerManager::unlink(Timer* timer)
+{
+    if (timer->m_level < 0)
+    {
+        return;
+    }
+
+    if (timer->m_prev)
+    {
+        timer->m_prev->m_next = timer->m_next;
     }
     else
     {
-        if (timerId < 1)
-        {
-            return;
-        }
+        TimerList* list = (timer->m_level == 0) ? &near_[timer->m_slot] : &far_[timer->m_level - 1][timer->m_slot];
+        list->head      = timer->m_next;
+    }
+    if (timer->m_next)
+    {
+        timer->m_next->m_prev = timer->m_prev;
+    }
 
-        std::unique_lock<std::mutex> lock(mutex_);
-        for (auto it = timer_.begin(); it != timer_.end();)
+    if (timer->m_level == 0)
+    {
+        --nearCount_;
+    }
+    timer->m_level = -1;
+    timer->m_prev  = nullptr;
+    timer->m_next  = nullptr;
+}
+
+void TimerManager::cascade(int level, unsigned long long index)
+{
+    Timer* timer            = far_[level][index].head;
+    far_[level][index].head = nullptr;
+    while (timer)
+    {
+        Timer* next    = timer->m_next;
+        timer->m_level = -1;
+        place(timer);
+        timer = next;
+    }
+}
+
+void TimerManager::runTick(std::vector<Timer*>& expired)
+{
+    unsigned long long index = current_ & kNearMask;
+    if (index == 0)
+    {
+        // 近轮转完一圈, 逐层把上层槽位的定时器下放
+        for (int level = 0; level < kFarLevels; ++level)
         {
-            if (it->m_id == timerId)
+            unsigned long long farIndex = (current_ >> (kNearBits + level * kFarBits)) & kFarMask;
+            cascade(level, farIndex);
+            if (farIndex != 0)
             {
-                it = timer_.erase(it);
                 break;
             }
-            else
-            {
-                ++it;
-            }
         }
+    }
 
-        timerId = 0;
-        // 重新调整堆
-        std::make_heap(timer_.begin(), timer_.end(), std::greater<Timer>());
+    Timer* timer      = near_[index].head;
+    near_[index].head = nullptr;
+    while (timer)
+    {
+        Timer* next        = timer->m_next;
+        timer->m_level     = -1;
+        timer->m_prev      = nullptr;
+        timer->m_next      = nullptr;
+        timer->m_isRunning = true;
+        --nearCount_;
+        expired.push_back(timer);
+        timer = next;
     }
+    ++current_;
 }
 
-void TimerManager::loopForExecute()
+void TimerManager::advance(unsigned long long tick, std::vector<Timer*>& expired)
 {
-    std::unique_lock<std::mutex> lock(mutex_, std::defer_lock);
-    lock.lock();
-    if (!timer_.empty())
+    // 只处理已经完整走过的 tick, 保证回调不会提前触发
+    while (current_ < tick)
     {
-        //取出堆顶元素
-        std::pop_heap(timer_.begin(), timer_.end(), std::greater<Timer>());
-        Timer top(this->timer_.back());
-        while (this->isStart_.load() && top.m_deadline <= this->timeline_)
+        if (nearCount_ == 0)
         {
-            //执行到时函数
-            top.m_action(); // 可能调用stopTimer
-
-            // 是否删除计时器
-            auto it = std::find(timer_.begin(), timer_.end(), top);
-            if (it == timer_.end())
+            // 近轮为空, 直接跳到下一个需要下放的槽位
+            unsigned long long next = nextCascadeTick();
+            if (next >= tick)
             {
+                current_ = tick;
                 break;
             }
+            current_ = next;
+        }
+        runTick(expired);
+    }
+}
+
+unsigned long long TimerManager::nextNearTick() const
+{
+    for (unsigned long long i = 0; i < kNearSize; ++i)
+    {
+        if (near_[(current_ + i) & kNearMask].head)
+        {
+            return current_ + i;
+        }
+    }
+    return kNoTick;
+}
 
-            if (timer_.empty())
+unsigned long long TimerManager::nextCascadeTick() const
+{
+    unsigned long long next = kNoTick;
+    for (int level = 0; level < kFarLevels; ++level)
+    {
+        const int shift               = kNearBits + level * kFarBits;
+        const unsigned long long span = 1ULL << shift;
+        // 当前 tick 之后(含)的第一个本层边界
+        unsigned long long boundary = (current_ + span - 1) & ~(span - 1);
+        for (unsigned long long i = 0; i < kFarSize && boundary < next; ++i, boundary += span)
+        {
+            if (far_[level][(boundary >> shift) & kFarMask].head)
             {
+                next = boundary;
                 break;
             }
+        }
+    }
+    return next;
+}
 
-            //从堆中删除
-            this->timer_.pop_back();
-
-            if (top.m_isRepeat)
+void TimerManager::loopForExecute()
+{
+    std::vector<Timer*> expired;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        advance(now(), expired);
+        if (expired.empty())
+        {
+            // 近轮里的定时器和上层下放的定时器, 谁先到就在谁那里醒来
+            nextWake_ = std::min(nearCount_ > 0 ? nextNearTick() : kNoTick, nextCascadeTick());
+            if (nextWake_ == kNoTick)
             {
-                //如果是重复事件,则重新添加
-                this->addTimer(top.m_interval, top.m_action, top.m_isRepeat, false, static_cast<int>(top.m_id));
+                cond_.wait(lock);
             }
-
-            if (timer_.empty())
+            else
             {
-                break;
+                cond_.wait_until(lock, epoch_ + std::chrono::milliseconds(nextWake_ + 1));
             }
-            std::pop_heap(timer_.begin(), timer_.end(), std::greater<Timer>());
-            top = this->timer_.back();
+            nextWake_ = kNoTick;
+            return;
         }
-        // 重新调整堆
-        std::make_heap(timer_.begin(), timer_.end(), std::greater<Timer>());
     }
-    lock.unlock();
-    //执行一次后等待一个周期
-    if (this->isStart_.load())
+
+    //执行到时函数, 不持锁, 回调里可以增删定时器
+    for (Timer* timer : expired)
+    {
+        if (this->isStart_.load() && !timer->m_isCancelled.load())
+        {
+            timer->m_action();
+        }
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (Timer* timer : expired)
     {
-        std::this_thread::sleep_for(this->tick_);
+        timer->m_isRunning = false;
+        if (timer->m_isCancelled || !timer->m_isRepeat || !this->isStart_.load())
+        {
+            if (!timer->m_isCancelled)
+            {
+                timers_.erase(timer->m_id);
+            }
+            delete timer;
+        }
+        else
+        {
+            //如果是重复事件,则重新添加
+            timer->m_deadline = now() + timer->m_interval;
+            place(timer);
+        }
     }
-    //周期增1
-    this->timeline_++;
-    // LOG_INFO << "+++++++ circle: " << this->timeline_;
 }
 
 void TimerManager::asyncWorkStart()
@@ -182,10 +346,8 @@ void TimerManager::asyncWorkStart()
 
 void TimerManager::syncWorkStart()
 {
-    threadId_ = std::this_thread::get_id();
-    if (!this->isStart_.load())
+    if (!this->isStart_.exchange(true))
     {
-        this->isStart_.exchange(true);
         while (this->isStart_.load())
         {
             this->loopForExecute();
@@ -195,5 +357,7 @@ void TimerManager::syncWorkStart()
 
 void TimerManager::workStop()
 {
+    std::unique_lock<std::mutex> lock(mutex_);
     this->isStart_.exchange(false);
+    cond_.notify_all();
 }
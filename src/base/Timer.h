@@ -14,9 +14,11 @@
 #define _TIMER_H
 #include <atomic>
 #include <chrono>
+#include <condition_variable>
 #include <functional>
 #include <mutex>
 #include <thread>
+#include <unordered_map>
 #include <vector>
 
 namespace toyBasket
@@ -25,21 +27,20 @@ namespace toyBasket
 class Timer
 {
 public:
-    Timer(unsigned int interval, unsigned long long timeline, std::function<void()> action, bool isRepeat,
-          bool isNoDelay)
+    Timer(unsigned long long id, unsigned int interval, unsigned long long deadline, std::function<void()> action,
+          bool isRepeat)
+        : m_id(id)
+        , m_interval(interval)
+        , m_deadline(deadline)
+        , m_action(std::move(action))
+        , m_isRepeat(isRepeat)
+        , m_isRunning(false)
+        , m_isCancelled(false)
+        , m_level(-1)
+        , m_slot(0)
+        , m_prev(nullptr)
+        , m_next(nullptr)
     {
-        this->m_interval             = interval;
-        isNoDelay ? this->m_deadline = timeline : this->m_deadline = interval + timeline;
-        this->m_action                                             = action;
-        this->m_isRepeat                                           = isRepeat;
-    }
-    bool operator>(const Timer& timer) const
-    {
-        return m_deadline > timer.m_deadline;
-    }
-    bool operator==(const Timer& timer) const
-    {
-        return m_id == timer.m_id;
     }
 
 public:
@@ -48,11 +49,23 @@ public:
 private:
     unsigned long long m_id;        //定时事件的唯一标示id
     unsigned int m_interval;        //事件的触发间隔，在重复事件中会用到这个属性
-    unsigned long long m_deadline;  //定时事件的触发时间
+    unsigned long long m_deadline;  //定时事件的触发时间(ms tick)
     std::function<void()> m_action; //触发的事件
     bool m_isRepeat;                //是否是重复执行事件
+    bool m_isRunning;               //已从时间轮摘下，正在等待执行
+    std::atomic<bool> m_isCancelled; //执行期间被删除, 执行线程在锁外读取
+    int m_level;                    //所在时间轮层级, -1 表示不在时间轮上
+    unsigned long long m_slot;      //所在层级的槽位下标
+    Timer* m_prev;                  //槽位双向链表
+    Timer* m_next;
 };
 
+///
+/// 分层时间轮定时器, 精度 1ms.
+///
+/// 第 0 层 256 个槽, 之后 4 层各 64 个槽, 可覆盖约 49 天.
+/// 添加/删除 O(1), 到期处理均摊 O(1); 没有到期事件时工作线程阻塞等待,
+/// 不再每毫秒轮询. 回调在锁外执行, 回调内可以安全地增删定时器.
 class TimerManager
 {
 public:
@@ -66,10 +79,11 @@ public:
 
     /**
      * @description  添加定时器事件
-     * @param interval 定时间隔
+     * @param interval 定时间隔(ms)
      * @param action 定时执行的动作
      * @param isRepeat 是否重复执行,默认不重复执行
      * @param isNoDelay 是否立即执行
+     * @param id 指定定时器id, 已存在的同id定时器会被替换
      * @return unsigned int 定时器的id,可以根据这个id执行删除操作
      */
     unsigned long long addTimer(unsigned int interval, std::function<void()> action, bool isRepeat = false,
@@ -97,25 +111,52 @@ public:
     void workStop();
 
 private:
+    static const int kNearBits                = 8;
+    static const int kFarBits                 = 6;
+    static const int kFarLevels               = 4;
+    static const unsigned long long kNearSize = 1ULL << kNearBits;
+    static const unsigned long long kFarSize  = 1ULL << kFarBits;
+    static const unsigned long long kNearMask = kNearSize - 1;
+    static const unsigned long long kFarMask  = kFarSize - 1;
+
+    struct TimerList
+    {
+        TimerList()
+            : head(nullptr)
+        {
+        }
+        Timer* head;
+    };
+
     /**
-     * 定时器处理
+     * 定时器处理, 等待到下一个事件并执行到期回调
      */
     void loopForExecute();
-    bool isInLoopThread() const
-    {
-        return threadId_ == std::this_thread::get_id();
-    }
+
+    // 以下函数需持有 mutex_
+    unsigned long long now() const;
+    void place(Timer* timer);
+    void unlink(Timer* timer);
+    void cascade(int level, unsigned long long index);
+    void runTick(std::vector<Timer*>& expired);
+    void advance(unsigned long long now, std::vector<Timer*>& expired);
+    unsigned long long nextNearTick() const;
+    unsigned long long nextCascadeTick() const;
+    void deleteTimerLocked(unsigned long long timerId);
 
 private:
-    std::chrono::milliseconds tick_;     //每次tick间隔
-    std::atomic<bool> isStart_;          //标志当前定时器的启动状态
-    unsigned long long timeline_;        //当前时间线
-    unsigned long long autoIncrementId_; //当前id
-    // std::thread threadId_;            //工作线程
+    std::atomic<bool> isStart_;                         //标志当前定时器的启动状态
+    const std::chrono::steady_clock::time_point epoch_; //时间线起点
+    unsigned long long current_;                        //下一个待处理的 tick
+    unsigned long long nextWake_;                       //工作线程计划唤醒的 tick
+    unsigned long long autoIncrementId_;                //当前id
 
     std::mutex mutex_;
-    std::vector<Timer> timer_;
-    std::thread::id threadId_;
+    std::condition_variable cond_;
+    TimerList near_[kNearSize];
+    TimerList far_[kFarLevels][kFarSize];
+    size_t nearCount_;
+    std::unordered_map<unsigned long long, Timer*> timers_;
 };
 
 } // namespace toyBasket
@@ -23,20 +23,87 @@ const char Buffer::kCRLF[] = "\r\n";
 const size_t Buffer::kCheapPrepend;
 const size_t Buffer::kInitialSize;
 
-ssize_t Buffer::readFd(int fd, int* savedErrno)
+// overflow area for readFd, one per thread instead of 64k of stack per call
+static __thread char t_extrabuf[65536];
+
+Buffer::Buffer(const Buffer& rhs)
+    : capacity_(rhs.capacity_)
+    , buffer_(rhs.buffer_ ? BufferPool::allocate(&capacity_) : NULL)
+    , initialCapacity_(rhs.initialCapacity_)
+    , readerIndex_(rhs.readerIndex_)
+    , writerIndex_(rhs.writerIndex_)
+{
+    if (buffer_)
+    {
+        ::memcpy(buffer_, rhs.buffer_, rhs.writerIndex_);
+    }
+}
+
+Buffer::Buffer(Buffer&& rhs)
+    : capacity_(rhs.initialCapacity_)
+    , buffer_(capacity_ > kCheapPrepend ? BufferPool::allocate(&capacity_) : NULL)
+    , initialCapacity_(rhs.initialCapacity_)
+    , readerIndex_(kCheapPrepend)
+    , writerIndex_(kCheapPrepend)
+{
+    swap(rhs);
+}
+
+Buffer::~Buffer()
+{
+    if (buffer_)
+    {
+        BufferPool::deallocate(buffer_, capacity_);
+    }
+}
+
+void Buffer::reallocate(size_t capacity)
 {
+    const size_t readable = readableBytes();
+    assert(kCheapPrepend + readable <= capacity);
+    char* buffer = BufferPool::allocate(&capacity);
+    if (buffer_)
+    {
+        ::memcpy(buffer + kCheapPrepend, peek(), readable);
+        BufferPool::deallocate(buffer_, capacity_);
+    }
+    buffer_      = buffer;
+    capacity_    = capacity;
+    readerIndex_ = kCheapPrepend;
+    writerIndex_ = readerIndex_ + readable;
+}
+
+void Buffer::releaseStorage()
+{
+    assert(readableBytes() == 0);
+    BufferPool::deallocate(buffer_, capacity_);
+    capacity_ = initialCapacity_;
+    buffer_   = capacity_ > kCheapPrepend ? BufferPool::allocate(&capacity_) : NULL;
+}
+
+ssize_t Buffer::readFd(int fd, int* savedErrno, bool* full)
+{
+    // an empty buffer borrows a chunk as big as extrabuf and reads into it directly,
+    // the chunk goes back to the pool once the data is consumed
+    if (readableBytes() == 0 && writableBytes() < sizeof t_extrabuf)
+    {
+        reallocate(sizeof t_extrabuf);
+    }
     // saved an ioctl()/FIONREAD call to tell how much to read
-    char extrabuf[65536];
     struct iovec vec[2];
     const size_t writable = writableBytes();
     vec[0].iov_base       = begin() + writerIndex_;
     vec[0].iov_len        = writable;
-    vec[1].iov_base       = extrabuf;
-    vec[1].iov_len        = sizeof extrabuf;
+    vec[1].iov_base       = t_extrabuf;
+    vec[1].iov_len        = sizeof t_extrabuf;
     // when there is enough space in this buffer, don't read into extrabuf.
     // when extrabuf is used, we read 128k-1 bytes at most.
-    const int iovcnt = (writable < sizeof extrabuf) ? 2 : 1;
+    const int iovcnt = (writable < sizeof t_extrabuf) ? 2 : 1;
     const ssize_t n  = ::readv(fd, vec, iovcnt);
+    if (full)
+    {
+        *full = n > 0 && static_cast<size_t>(n) == (iovcnt == 2 ? writable + sizeof t_extrabuf : writable);
+    }
     if (n < 0)
     {
         *savedErrno = errno;
@@ -47,12 +114,13 @@ ssize_t Buffer::readFd(int fd, int* savedErrno)
     }
     else
     {
-        writerIndex_ = buffer_.size();
-        append(extrabuf, static_cast<size_t>(n) - writable);
+        writerIndex_ = capacity_;
+        append(t_extrabuf, static_cast<size_t>(n) - writable);
+    }
+    if (n <= 0 && readableBytes() == 0)
+    {
+        // nothing came, don't keep the borrowed chunk
+        retrieveAll();
     }
-    // if (n == writable + sizeof extrabuf)
-    // {
-    //   goto line_30;
-    // }
     return n;
 }
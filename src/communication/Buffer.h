@@ -14,11 +14,11 @@
 #ifndef _BUFFER_H
 #define _BUFFER_H
 
+#include "BufferPool.h"
 #include "StringPiece.h"
 
 #include <algorithm>
 #include <endian.h>
-#include <vector>
 
 #include <assert.h>
 #include <string.h>
@@ -37,6 +37,11 @@ namespace toyBasket
 /// |                   |                  |                  |
 /// 0      <=      readerIndex   <=   writerIndex    <=     size
 /// @endcode
+///
+/// Storage comes from BufferPool. When a buffer that grew for a burst is
+/// drained, the big chunk goes back to the pool and the buffer returns to
+/// its initial size. A buffer with initial size 0 is lazy: it holds no
+/// storage at all while it is empty.
 class Buffer
 {
 public:
@@ -44,21 +49,33 @@ public:
     static const size_t kInitialSize  = 1024;
 
     explicit Buffer(size_t initialSize = kInitialSize)
-        : buffer_(kCheapPrepend + initialSize)
+        : capacity_(kCheapPrepend + initialSize)
+        , buffer_(initialSize > 0 ? BufferPool::allocate(&capacity_) : NULL)
+        , initialCapacity_(capacity_)
         , readerIndex_(kCheapPrepend)
         , writerIndex_(kCheapPrepend)
     {
         assert(readableBytes() == 0);
-        assert(writableBytes() == initialSize);
+        assert(writableBytes() >= initialSize);
         assert(prependableBytes() == kCheapPrepend);
     }
 
-    // implicit copy-ctor, move-ctor, dtor and assignment are fine
-    // NOTE: implicit move-ctor is added in g++ 4.6
+    Buffer(const Buffer& rhs);
+    /// @c rhs is left empty, with storage of its initial size.
+    Buffer(Buffer&& rhs);
+    ~Buffer();
+
+    Buffer& operator=(Buffer rhs)
+    {
+        swap(rhs);
+        return *this;
+    }
 
     void swap(Buffer& rhs)
     {
-        buffer_.swap(rhs.buffer_);
+        std::swap(capacity_, rhs.capacity_);
+        std::swap(buffer_, rhs.buffer_);
+        std::swap(initialCapacity_, rhs.initialCapacity_);
         std::swap(readerIndex_, rhs.readerIndex_);
         std::swap(writerIndex_, rhs.writerIndex_);
     }
@@ -70,7 +87,7 @@ public:
 
     size_t writableBytes() const
     {
-        return buffer_.size() - writerIndex_;
+        return capacity_ - writerIndex_;
     }
 
     size_t prependableBytes() const
@@ -160,6 +177,10 @@ public:
     {
         readerIndex_ = kCheapPrepend;
         writerIndex_ = kCheapPrepend;
+        if (capacity_ > initialCapacity_)
+        {
+            releaseStorage();
+        }
     }
 
     std::string retrieveAllAsString()
@@ -364,6 +385,10 @@ public:
     void prepend(const void* /*restrict*/ data, size_t len)
     {
         assert(len <= prependableBytes());
+        if (buffer_ == NULL)
+        {
+            reallocate(kCheapPrepend);
+        }
         readerIndex_ -= len;
         const char* d = static_cast<const char*>(data);
         std::copy(d, d + len, begin() + readerIndex_);
@@ -371,41 +396,39 @@ public:
 
     void shrink(size_t reserve)
     {
-        // FIXME: use vector::shrink_to_fit() in C++ 11 if possible.
-        Buffer other;
-        other.ensureWritableBytes(readableBytes() + reserve);
-        other.append(toStringPiece());
-        swap(other);
+        reallocate(kCheapPrepend + readableBytes() + reserve);
     }
 
     size_t internalCapacity() const
     {
-        return buffer_.capacity();
+        return buffer_ ? capacity_ : 0;
     }
 
     /// Read data directly into buffer.
     ///
     /// It may implement with readv(2)
+    /// @param full if not NULL, set to whether the read used all the room it
+    ///        offered, that is, whether @c fd may have more to read
     /// @return result of read(2), @c errno is saved
-    ssize_t readFd(int fd, int* savedErrno);
+    ssize_t readFd(int fd, int* savedErrno, bool* full = NULL);
 
 private:
     char* begin()
     {
-        return &*buffer_.begin();
+        return buffer_;
     }
 
     const char* begin() const
     {
-        return &*buffer_.begin();
+        return buffer_;
     }
 
     void makeSpace(size_t len)
     {
         if (writableBytes() + prependableBytes() < len + kCheapPrepend)
         {
-            // FIXME: move readable data
-            buffer_.resize(writerIndex_ + len);
+            // grow geometrically like vector did, readable data moves to the front on the way
+            reallocate(std::max(2 * capacity_, kCheapPrepend + readableBytes() + len));
         }
         else
         {
@@ -419,8 +442,15 @@ private:
         }
     }
 
+    /// Moves the readable bytes into a chunk of at least @c capacity bytes.
+    void reallocate(size_t capacity);
+    /// Swaps a drained, grown chunk for one of the initial size, or drops it if the buffer is lazy.
+    void releaseStorage();
+
 private:
-    std::vector<char> buffer_;
+    size_t capacity_;
+    char* buffer_;
+    size_t initialCapacity_;
     size_t readerIndex_;
     size_t writerIndex_;
 
@@ -0,0 +1,145 @@
+/******************************************************************************
+ * File name     : BufferChain.cpp
+ * Description   :
+ * Version       : v1.0
+ * Create Time   : 2026/10/17
+ * Author        : andy
+ * Modify history:
+ *******************************************************************************
+ * Modify Time   Modify person  Modification
+ * ------------------------------------------------------------------------------
+ *
+ *******************************************************************************/
+
+#include "BufferChain.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cerrno>
+#include <iterator>
+#include <sys/uio.h>
+
+using namespace toyBasket;
+
+const size_t BufferChain::kCopyBlockSize;
+const int BufferChain::kMaxIovecs;
+
+void BufferChain::push(const Slice& slice)
+{
+    if (!slices_)
+    {
+        slices_.reset(new std::deque<Slice>);
+    }
+    slices_->push_back(slice);
+    readable_ += slice.length;
+}
+
+void BufferChain::append(const char* data, size_t len)
+{
+    if (len == 0)
+    {
+        return;
+    }
+
+    if (slices_ && !slices_->empty())
+    {
+        Slice& tail = slices_->back();
+        // only grow the tail inside its reserved capacity, so queued bytes never move
+        if (tail.writable && tail.writable->capacity() - tail.writable->size() >= len)
+        {
+            tail.writable->append(data, len);
+            tail.length += len;
+            readable_ += len;
+            return;
+        }
+    }
+
+    std::shared_ptr<std::string> block(new std::string);
+    block->reserve(std::max(len, kCopyBlockSize));
+    block->append(data, len);
+    Slice slice = { block, block.get(), 0, len };
+    push(slice);
+}
+
+void BufferChain::append(const Block& block, size_t offset)
+{
+    assert(block);
+    assert(offset <= block->size());
+    size_t len = block->size() - offset;
+    if (len == 0)
+    {
+        return;
+    }
+
+    Slice slice = { block, NULL, offset, len };
+    push(slice);
+}
+
+void BufferChain::append(BufferChain&& other)
+{
+    // other gives up its blocks, so its copy tail may keep growing here
+    if (other.readable_ == 0)
+    {
+        return;
+    }
+    if (readable_ == 0)
+    {
+        slices_.swap(other.slices_);
+    }
+    else
+    {
+        std::move(other.slices_->begin(), other.slices_->end(), std::back_inserter(*slices_));
+        other.slices_->clear();
+    }
+    readable_ += other.readable_;
+    other.readable_ = 0;
+}
+
+int BufferChain::peekIovec(struct iovec* iov, int iovcnt) const
+{
+    int n = 0;
+    if (!slices_)
+    {
+        return n;
+    }
+    for (std::deque<Slice>::const_iterator it = slices_->begin(); it != slices_->end() && n < iovcnt; ++it, ++n)
+    {
+        iov[n].iov_base = const_cast<char*>(it->block->data() + it->offset);
+        iov[n].iov_len  = it->length;
+    }
+    return n;
+}
+
+void BufferChain::retrieve(size_t len)
+{
+    assert(len <= readableBytes());
+    readable_ -= len;
+    while (len > 0)
+    {
+        Slice& head = slices_->front();
+        if (len < head.length)
+        {
+            head.offset += len;
+            head.length -= len;
+            break;
+        }
+        len -= head.length;
+        slices_->pop_front();
+    }
+}
+
+ssize_t BufferChain::writeFd(int fd, int* savedErrno)
+{
+    struct iovec vec[kMaxIovecs];
+    const int iovcnt = peekIovec(vec, kMaxIovecs);
+    const ssize_t n  = ::writev(fd, vec, iovcnt);
+    if (n < 0)
+    {
+        *savedErrno = errno;
+    }
+    else
+    {
+        retrieve(static_cast<size_t>(n));
+    }
+    return n;
+}
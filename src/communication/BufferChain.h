@@ -0,0 +1,163 @@
+/******************************************************************************
+ * File name     : BufferChain.h
+ * Description   :
+ * Version       : v1.0
+ * Create Time   : 2026/10/17
+ * Author        : andy
+ * Modify history:
+ *******************************************************************************
+ * Modify Time   Modify person  Modification
+ * ------------------------------------------------------------------------------
+ *
+ *******************************************************************************/
+
+#ifndef _BUFFERCHAIN_H
+#define _BUFFERCHAIN_H
+
+#include "StringPiece.h"
+#include "noncopyable.h"
+
+#include <algorithm>
+#include <deque>
+#include <memory>
+#include <string>
+
+#include <sys/types.h>
+
+struct iovec;
+
+namespace toyBasket
+{
+
+/// A segmented output queue.
+///
+/// Each slice refers to a refcounted block. Blocks handed in with
+/// append(Block) are shared, never copied, so one payload can sit in the
+/// output queue of many connections at once. Small copied writes are
+/// packed into private blocks of kCopyBlockSize bytes; a block is never
+/// reallocated once queued, so pending data is never moved.
+///
+/// The slice queue itself is only allocated on the first append, an idle
+/// chain can give it back with shrink().
+///
+/// Move-only, the tail block is appended to in place and must have a
+/// single owner.
+///
+/// @code
+/// +---------+   +---------------------+   +-------+
+/// | slice 0 |-->| slice 1 (shared)    |-->| tail  | <- copies go here
+/// +---------+   +---------------------+   +-------+
+/// @endcode
+class BufferChain : noncopyable
+{
+public:
+    typedef std::shared_ptr<const std::string> Block;
+
+    static const size_t kCopyBlockSize = 16 * 1024;
+    static const int kMaxIovecs        = 64;
+
+    BufferChain()
+        : readable_(0)
+    {
+    }
+
+    BufferChain(BufferChain&& rhs)
+        : readable_(0)
+    {
+        swap(rhs);
+    }
+
+    BufferChain& operator=(BufferChain&& rhs)
+    {
+        BufferChain tmp(std::move(rhs));
+        swap(tmp);
+        return *this;
+    }
+
+    void swap(BufferChain& rhs)
+    {
+        slices_.swap(rhs.slices_);
+        std::swap(readable_, rhs.readable_);
+    }
+
+    size_t readableBytes() const
+    {
+        return readable_;
+    }
+
+    bool empty() const
+    {
+        return readable_ == 0;
+    }
+
+    size_t numSlices() const
+    {
+        return slices_ ? slices_->size() : 0;
+    }
+
+    /// Copies @c data into the tail block.
+    void append(const char* /*restrict*/ data, size_t len);
+
+    void append(const void* /*restrict*/ data, size_t len)
+    {
+        append(static_cast<const char*>(data), len);
+    }
+
+    void append(const StringPiece& str)
+    {
+        append(str.data(), static_cast<size_t>(str.size()));
+    }
+
+    /// Queues the bytes of @c block from @c offset on, without copying.
+    void append(const Block& block, size_t offset = 0);
+
+    /// Moves all slices of @c other behind ours, leaving it empty.
+    void append(BufferChain&& other);
+
+    /// Fills at most @c iovcnt entries with the leading slices.
+    /// @return number of entries used
+    int peekIovec(struct iovec* iov, int iovcnt) const;
+
+    void retrieve(size_t len);
+
+    void retrieveAll()
+    {
+        if (slices_)
+        {
+            slices_->clear();
+        }
+        readable_ = 0;
+    }
+
+    /// Frees the slice queue if the chain is empty.
+    void shrink()
+    {
+        if (readable_ == 0)
+        {
+            slices_.reset();
+        }
+    }
+
+    /// Writes as many slices as possible with one writev(2).
+    ///
+    /// @return result of writev(2), @c errno is saved
+    ssize_t writeFd(int fd, int* savedErrno);
+
+private:
+    struct Slice
+    {
+        Block block;
+        std::string* writable; // non-NULL for private copy blocks
+        size_t offset;
+        size_t length;
+    };
+
+    void push(const Slice& slice);
+
+    std::unique_ptr<std::deque<Slice>> slices_;
+    size_t readable_;
+};
+
+} // namespace toyBasket
+
+#endif // _BUFFERCHAIN_H
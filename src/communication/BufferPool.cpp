@@ -0,0 +1,280 @@
+/******************************************************************************
+ * File name     : BufferPool.cpp
+ * Description   :
+ * Version       : v1.0
+ * Create Time   : 2026/10/17
+ * Author        : andy
+ * Modify history:
+ *******************************************************************************
+ * Modify Time   Modify person  Modification
+ * ------------------------------------------------------------------------------
+ *
+ *******************************************************************************/
+
+#include "BufferPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+#include <stdint.h>
+#include <sys/mman.h>
+#include <vector>
+
+using namespace toyBasket;
+
+const size_t BufferPool::kMinChunkSize;
+const size_t BufferPool::kMaxChunkSize;
+const int BufferPool::kNumClasses;
+const size_t BufferPool::kSlabSize;
+const size_t BufferPool::kMaxThreadCacheBytes;
+
+namespace
+{
+
+// bytes of chunks moved between a thread and the depot at once
+const size_t kBatchBytes = 64 * 1024;
+
+std::atomic<bool> g_hugePages(false);
+
+size_t chunkSize(int index)
+{
+    return BufferPool::kMinChunkSize << index;
+}
+
+int sizeClass(size_t size)
+{
+    assert(size <= BufferPool::kMaxChunkSize);
+    int index = 0;
+    while (chunkSize(index) < size)
+    {
+        ++index;
+    }
+    return index;
+}
+
+size_t batchCount(int index)
+{
+    return std::max<size_t>(1, kBatchBytes / chunkSize(index));
+}
+
+char* mapSlab()
+{
+    const bool huge  = g_hugePages.load(std::memory_order_relaxed);
+    // huge pages need a kSlabSize aligned range, map twice as much and trim
+    const size_t len = huge ? 2 * BufferPool::kSlabSize : BufferPool::kSlabSize;
+    void* p          = ::mmap(NULL, len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (p == MAP_FAILED)
+    {
+        throw std::bad_alloc();
+    }
+    char* slab = static_cast<char*>(p);
+    if (huge)
+    {
+        uintptr_t addr    = reinterpret_cast<uintptr_t>(slab);
+        uintptr_t aligned = (addr + BufferPool::kSlabSize - 1) & ~(BufferPool::kSlabSize - 1);
+        size_t head       = aligned - addr;
+        if (head > 0)
+        {
+            ::munmap(slab, head);
+        }
+        if (len - head > BufferPool::kSlabSize)
+        {
+            ::munmap(reinterpret_cast<char*>(aligned) + BufferPool::kSlabSize, len - head - BufferPool::kSlabSize);
+        }
+        slab = reinterpret_cast<char*>(aligned);
+        // only a hint, the kernel may still use small pages
+        ::madvise(slab, BufferPool::kSlabSize, MADV_HUGEPAGE);
+    }
+    return slab;
+}
+
+/// Chunks no thread holds, shared by all threads.
+class Depot
+{
+public:
+    Depot()
+        : slab_(NULL)
+        , slabLeft_(0)
+    {
+    }
+
+    /// Moves up to @c count chunks of class @c index into @c out.
+    void get(int index, size_t count, std::vector<char*>* out)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::vector<char*>& list = free_[index];
+        while (count > 0 && !list.empty())
+        {
+            out->push_back(list.back());
+            list.pop_back();
+            --count;
+        }
+        const size_t size = chunkSize(index);
+        for (; count > 0; --count)
+        {
+            if (slabLeft_ < size)
+            {
+                retireSlab();
+                slab_     = mapSlab();
+                slabLeft_ = BufferPool::kSlabSize;
+            }
+            out->push_back(slab_);
+            slab_ += size;
+            slabLeft_ -= size;
+        }
+    }
+
+    void put(int index, char* chunk)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        free_[index].push_back(chunk);
+    }
+
+    /// Moves the chunks of @c in from position @c from on back into the depot.
+    void put(int index, std::vector<char*>* in, size_t from)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        free_[index].insert(free_[index].end(), in->begin() + static_cast<ptrdiff_t>(from), in->end());
+        in->resize(from);
+    }
+
+private:
+    /// Cuts what is left of the current slab into smaller chunks.
+    void retireSlab()
+    {
+        for (int index = BufferPool::kNumClasses - 1; index >= 0; --index)
+        {
+            const size_t size = chunkSize(index);
+            while (slabLeft_ >= size)
+            {
+                free_[index].push_back(slab_);
+                slab_ += size;
+                slabLeft_ -= size;
+            }
+        }
+    }
+
+    std::mutex mutex_;
+    std::vector<char*> free_[BufferPool::kNumClasses];
+    char* slab_;
+    size_t slabLeft_;
+};
+
+Depot& depot()
+{
+    // never destroyed, threads may still free chunks after main returns
+    static Depot* depot = new Depot;
+    return *depot;
+}
+
+struct ThreadCache
+{
+    ThreadCache()
+        : bytes(0)
+    {
+    }
+
+    ~ThreadCache();
+
+    /// Keeps one batch of class @c index for the next burst, the rest is
+    /// for other threads.
+    void trim(int index)
+    {
+        std::vector<char*>& list = free[index];
+        const size_t keep        = std::min(list.size(), batchCount(index));
+        bytes -= (list.size() - keep) * chunkSize(index);
+        depot().put(index, &list, keep);
+    }
+
+    std::vector<char*> free[BufferPool::kNumClasses];
+    size_t bytes;
+};
+
+__thread bool t_cacheDestroyed = false;
+thread_local ThreadCache t_cache;
+
+ThreadCache::~ThreadCache()
+{
+    for (int index = 0; index < BufferPool::kNumClasses; ++index)
+    {
+        depot().put(index, &free[index], 0);
+    }
+    t_cacheDestroyed = true;
+}
+
+} // namespace
+
+char* BufferPool::allocate(size_t* size)
+{
+    if (*size > kMaxChunkSize)
+    {
+        void* p = ::malloc(*size);
+        if (p == NULL)
+        {
+            throw std::bad_alloc();
+        }
+        return static_cast<char*>(p);
+    }
+
+    const int index = sizeClass(*size);
+    *size           = chunkSize(index);
+    if (t_cacheDestroyed)
+    {
+        // a Buffer created while this thread exits
+        std::vector<char*> chunk;
+        depot().get(index, 1, &chunk);
+        return chunk.back();
+    }
+
+    std::vector<char*>& list = t_cache.free[index];
+    if (list.empty())
+    {
+        depot().get(index, batchCount(index), &list);
+        t_cache.bytes += list.size() * *size;
+    }
+    char* chunk = list.back();
+    list.pop_back();
+    t_cache.bytes -= *size;
+    return chunk;
+}
+
+void BufferPool::deallocate(char* chunk, size_t size)
+{
+    if (size > kMaxChunkSize)
+    {
+        ::free(chunk);
+        return;
+    }
+
+    const int index = sizeClass(size);
+    if (t_cacheDestroyed)
+    {
+        depot().put(index, chunk);
+        return;
+    }
+
+    std::vector<char*>& list = t_cache.free[index];
+    list.push_back(chunk);
+    t_cache.bytes += size;
+    if (t_cache.bytes > kMaxThreadCacheBytes)
+    {
+        // the class just freed first, then the others until under the cap,
+        // one batch of each class is always below it
+        t_cache.trim(index);
+        for (int other = 0; other < kNumClasses && t_cache.bytes > kMaxThreadCacheBytes; ++other)
+        {
+            if (other != index)
+            {
+                t_cache.trim(other);
+            }
+        }
+    }
+}
+
+void BufferPool::setHugePages(bool on)
+{
+    g_hugePages.store(on, std::memory_order_relaxed);
+}
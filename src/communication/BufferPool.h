@@ -0,0 +1,58 @@
+/******************************************************************************
+ * File name     : BufferPool.h
+ * Description   :
+ * Version       : v1.0
+ * Create Time   : 2026/10/17
+ * Author        : andy
+ * Modify history:
+ *******************************************************************************
+ * Modify Time   Modify person  Modification
+ * ------------------------------------------------------------------------------
+ *
+ *******************************************************************************/
+
+#ifndef _BUFFERPOOL_H
+#define _BUFFERPOOL_H
+
+#include <stddef.h>
+
+namespace toyBasket
+{
+
+/// Size-classed storage for Buffer.
+///
+/// Chunks are powers of two from kMinChunkSize to kMaxChunkSize, carved
+/// out of kSlabSize slabs that are never unmapped. Every thread (that is,
+/// every EventLoop) keeps its own free lists and only takes the depot lock
+/// to move a batch of chunks in or out, so a connection that comes and
+/// goes, or a burst that grows a buffer, reuses chunks instead of calling
+/// malloc. Larger requests go straight to malloc.
+///
+/// A chunk may be freed by a different thread than the one that
+/// allocated it; it then joins that thread's free list.
+class BufferPool
+{
+public:
+    static const size_t kMinChunkSize = 2 * 1024;
+    static const size_t kMaxChunkSize = 256 * 1024;
+    static const int kNumClasses      = 8;
+    static const size_t kSlabSize     = 2 * 1024 * 1024;
+    /// Free bytes a thread keeps before handing chunks back to the depot.
+    static const size_t kMaxThreadCacheBytes = 4 * 1024 * 1024;
+
+    /// Returns a chunk of at least @c *size bytes and stores its real size
+    /// back into @c *size.
+    /// @throw std::bad_alloc
+    static char* allocate(size_t* size);
+
+    /// @c size must be the value allocate() stored.
+    static void deallocate(char* chunk, size_t size);
+
+    /// Backs new slabs with transparent huge pages, off by default.
+    /// Slabs mapped before the call are not affected.
+    static void setHugePages(bool on);
+};
+
+} // namespace toyBasket
+
+#endif // _BUFFERPOOL_H
@@ -14,6 +14,7 @@
 #ifndef _CALLBACKS_H
 #define _CALLBACKS_H
 
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <sys/socket.h>
@@ -44,7 +45,11 @@ class InetAddress;
 class Buffer;
 class StreamConnection;
 class Serial;
+struct Datagram;
 typedef std::shared_ptr<StreamConnection> StreamConnectionPtr;
+// monotonic clock shared by EventLoop timers
+typedef std::chrono::steady_clock Clock;
+typedef Clock::time_point TimePoint;
 typedef std::function<void()> TimerCallback;
 typedef std::function<void(const StreamConnectionPtr&)> ConnectionCallback;
 typedef std::function<void(const StreamConnectionPtr&)> CloseCallback;
@@ -56,6 +61,8 @@ typedef std::function<void(const StreamConnectionPtr&, Buffer*)> MessageCallback
 
 // for udp
 typedef std::function<void(const InetAddress&, const void*, int)> DgramEventCallback;
+// a batch of datagrams from one recvmmsg, valid only during the call
+typedef std::function<void(const Datagram*, int)> DgramBatchCallback;
 
 typedef std::function<void(const struct sockaddr&, const void*, int)> InetEventCallback;
 
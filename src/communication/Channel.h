@@ -111,6 +111,23 @@ public:
         return events_ & kReadEvent;
     }
 
+    /// Asks the poller to report only changes in readiness (EPOLLET), the
+    /// owner must then read and write until EAGAIN. Off by default, honoured
+    /// by EPollPoller and IoUringPoller (multishot poll).
+    /// Call in loop, or before the first enable*().
+    void setEdgeTriggered(bool on)
+    {
+        edgeTriggered_ = on;
+        if (!isNoneEvent())
+        {
+            update();
+        }
+    }
+    bool isEdgeTriggered() const
+    {
+        return edgeTriggered_;
+    }
+
     // for Poller
     int index()
     {
@@ -157,6 +174,7 @@ private:
     int revents_; // it's the received event types of epoll or poll
     int index_;   // used by Poller.
     bool logHup_;
+    bool edgeTriggered_;
 
     std::weak_ptr<void> tie_;
     bool tied_;
@@ -13,6 +13,8 @@
 
 #include "Poller.h"
 #include "EPollPoller.h"
+#include "IoUringPoller.h"
+#include "Types.h"
 
 #include <cstdlib>
 
@@ -27,5 +29,13 @@ Poller* Poller::newDefaultPoller(EventLoop* loop)
         return new EPollPoller(loop);
     }
 #endif
+    if (::getenv("USE_IO_URING"))
+    {
+        if (IoUringPoller::isSupported())
+        {
+            return new IoUringPoller(loop);
+        }
+        LOG_WARNING << "io_uring is not available, falling back to epoll";
+    }
     return new EPollPoller(loop);
 }
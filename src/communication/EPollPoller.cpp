@@ -58,12 +58,20 @@ EPollPoller::~EPollPoller()
 
 void EPollPoller::poll(int timeoutMs, ChannelList* activeChannels)
 {
-    LOG_INFO << "fd total count " << m_channels.size();
+    // busy polling calls this back to back with a zero timeout, keep quiet then
+    const bool verbose = timeoutMs != 0;
+    if (verbose)
+    {
+        LOG_INFO << "fd total count " << m_channels.size();
+    }
     int numEvents  = ::epoll_wait(epollfd_, &*events_.begin(), static_cast<int>(events_.size()), timeoutMs);
     int savedErrno = errno;
     if (numEvents > 0)
     {
-        LOG_INFO << numEvents << " events happened";
+        if (verbose)
+        {
+            LOG_INFO << numEvents << " events happened";
+        }
         fillActiveChannels(numEvents, activeChannels);
         if (static_cast<size_t>(numEvents) == events_.size())
         {
@@ -72,7 +80,10 @@ void EPollPoller::poll(int timeoutMs, ChannelList* activeChannels)
     }
     else if (numEvents == 0)
     {
-        LOG_INFO << "nothing happened";
+        if (verbose)
+        {
+            LOG_INFO << "nothing happened";
+        }
     }
     else
     {
@@ -172,6 +183,10 @@ void EPollPoller::update(int operation, Channel* channel)
     event.events             = static_cast<unsigned int>(channel->events());
     event.data.ptr           = channel;
     int fd                   = channel->fd();
+    if (channel->isEdgeTriggered())
+    {
+        event.events |= EPOLLET;
+    }
     LOG_INFO << "epoll_ctl op = " << operationToString(operation) << " fd = " << fd << " event = { "
              << channel->eventsToString() << " }";
     if (::epoll_ctl(epollfd_, operation, fd, &event) < 0)
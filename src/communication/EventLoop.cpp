@@ -15,6 +15,7 @@
 
 #include "Channel.h"
 #include "Poller.h"
+#include "TimerQueue.h"
 #include "Types.h"
 
 #include <algorithm>
@@ -67,9 +68,20 @@ EventLoop::EventLoop()
     , callingPendingFunctors_(false)
     , threadId_(std::this_thread::get_id())
     , poller_(Poller::newDefaultPoller(this))
+    , timerQueue_(new TimerQueue(this))
     , wakeupFd_(createEventfd())
     , wakeupChannel_(new Channel(this, wakeupFd_))
     , currentActiveChannel_(NULL)
+    , wakeupPending_(false)
+    , spinMaxUs_(0)
+    , spinUs_(0)
+    , socketBusyPollUs_(0)
+    , busyPollEnabled_(false)
+    , spinning_(false)
+    , spinNs_(0)
+    , sleepNs_(0)
+    , spinHits_(0)
+    , sleeps_(0)
 {
     LOG_INFO << "EventLoop created " << this << " in thread " << threadId_;
     if (t_loopInThisThread)
@@ -106,7 +118,14 @@ void EventLoop::loop()
     while (!quit_)
     {
         activeChannels_.clear();
-        poller_->poll(kPollTimeMs, &activeChannels_);
+        if (spinMaxUs_ > 0)
+        {
+            busyPoll();
+        }
+        else
+        {
+            poller_->poll(kPollTimeMs, &activeChannels_);
+        }
 
         // TODO sort channel by priority
         eventHandling_ = true;
@@ -151,12 +170,18 @@ void EventLoop::runInLoop(Functor cb)
 
 void EventLoop::queueInLoop(Functor cb)
 {
+    pendingFunctors_.push(std::move(cb));
+    bool spinning = false;
+    if (busyPollEnabled_.load(std::memory_order_relaxed))
     {
-        std::lock_guard<std::mutex> lock(mutex_);
-        pendingFunctors_.push_back(std::move(cb));
+        // pairs with the fence in busyPoll()
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        spinning = spinning_.load(std::memory_order_relaxed);
     }
 
-    if (!isInLoopThread() || callingPendingFunctors_)
+    // only the first producer since the last drain pays for the eventfd write,
+    // and none while the loop spins, it will see the functor by itself
+    if ((!isInLoopThread() || callingPendingFunctors_) && !spinning && !wakeupPending_.exchange(true))
     {
         wakeup();
     }
@@ -164,10 +189,33 @@ void EventLoop::queueInLoop(Functor cb)
 
 size_t EventLoop::queueSize() const
 {
-    std::lock_guard<std::mutex> lock(mutex_);
     return pendingFunctors_.size();
 }
 
+TimerId EventLoop::runAt(TimePoint time, TimerCallback cb)
+{
+    return timerQueue_->addTimer(std::move(cb), time, 0.0);
+}
+
+TimerId EventLoop::runAfter(double delay, TimerCallback cb)
+{
+    TimePoint time(Clock::now()
+                   + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(delay)));
+    return runAt(time, std::move(cb));
+}
+
+TimerId EventLoop::runEvery(double interval, TimerCallback cb)
+{
+    TimePoint time(Clock::now()
+                   + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(interval)));
+    return timerQueue_->addTimer(std::move(cb), time, interval);
+}
+
+void EventLoop::cancel(TimerId timerId)
+{
+    return timerQueue_->cancel(timerId);
+}
+
 void EventLoop::updateChannel(Channel* channel)
 {
     assert(channel->ownerLoop() == this);
@@ -222,19 +270,79 @@ void EventLoop::handleRead()
 
 void EventLoop::doPendingFunctors()
 {
-    std::vector<Functor> functors;
+    Functor functor;
     callingPendingFunctors_ = true;
+    // cleared before draining: a producer either sees false and wakes us up,
+    // or its functor is already in the queue and gets run below
+    wakeupPending_.store(false);
+
+    // functors queued while draining wait for the next iteration, their
+    // producers have woken us up again; size() is seq_cst like the store
+    // above, so it counts every functor whose producer saw the flag still set
+    size_t n = pendingFunctors_.size();
+    while (n-- > 0 && pendingFunctors_.pop(functor))
+    {
+        functor();
+    }
+    callingPendingFunctors_ = false;
+}
 
+void EventLoop::setBusyPoll(int spinMicroseconds, int socketBusyPollMicroseconds)
+{
+    spinMaxUs_        = std::max(0, spinMicroseconds);
+    spinUs_           = spinMaxUs_;
+    socketBusyPollUs_ = std::max(0, socketBusyPollMicroseconds);
+    busyPollEnabled_.store(spinMaxUs_ > 0, std::memory_order_relaxed);
+}
+
+EventLoop::PollStats EventLoop::pollStats() const
+{
+    PollStats stats;
+    stats.spinNs   = spinNs_.load(std::memory_order_relaxed);
+    stats.sleepNs  = sleepNs_.load(std::memory_order_relaxed);
+    stats.spinHits = spinHits_.load(std::memory_order_relaxed);
+    stats.sleeps   = sleeps_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void EventLoop::busyPoll()
+{
+    const TimePoint start    = Clock::now();
+    const TimePoint deadline = start + std::chrono::microseconds(spinUs_);
+    TimePoint now            = start;
+    spinning_.store(true, std::memory_order_relaxed);
+    do
     {
-        std::lock_guard<std::mutex> lock(mutex_);
-        functors.swap(pendingFunctors_);
+        poller_->poll(0, &activeChannels_);
+        now = Clock::now();
+    } while (activeChannels_.empty() && pendingFunctors_.size() == 0 && !quit_ && now < deadline);
+    spinning_.store(false, std::memory_order_relaxed);
+    // a producer that saw us spinning has its functor counted by now
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    spinNs_.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(now - start).count(),
+                      std::memory_order_relaxed);
+
+    if (!activeChannels_.empty() || pendingFunctors_.size() > 0 || quit_)
+    {
+        spinHits_.fetch_add(1, std::memory_order_relaxed);
+        spinUs_ = std::min(spinMaxUs_, spinUs_ * 2);
+        return;
     }
 
-    for (const Functor& functor : functors)
+    poller_->poll(kPollTimeMs, &activeChannels_);
+    const TimePoint woken = Clock::now();
+    sleepNs_.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(woken - now).count(),
+                       std::memory_order_relaxed);
+    sleeps_.fetch_add(1, std::memory_order_relaxed);
+    // a wait that a longer spin would have covered widens the window, a long idle narrows it
+    if (woken - now < std::chrono::microseconds(spinMaxUs_))
     {
-        functor();
+        spinUs_ = std::min(spinMaxUs_, spinUs_ * 2);
+    }
+    else
+    {
+        spinUs_ = std::max(std::max(1, spinMaxUs_ / 8), spinUs_ / 2);
     }
-    callingPendingFunctors_ = false;
 }
 
 void EventLoop::printActiveChannels() const
@@ -14,11 +14,14 @@
 #ifndef _EVENTLOOP_H
 #define _EVENTLOOP_H
 
+#include "Callbacks.h"
+#include "MpscQueue.h"
+#include "TimerId.h"
 #include "noncopyable.h"
 
 #include <atomic>
 #include <functional>
-#include <mutex>
+#include <stdint.h>
 #include <thread>
 #include <vector>
 
@@ -26,6 +29,7 @@ namespace toyBasket {
 
 class Channel;
 class Poller;
+class TimerQueue;
 
 ///
 /// Reactor, at most one per thread.
@@ -62,6 +66,52 @@ public:
 
   size_t queueSize() const;
 
+  /// Busy polling, for latency critical loops.
+  ///
+  /// Before blocking in the poller, the loop polls with a zero timeout for
+  /// up to @c spinMicroseconds, so an event that comes soon after the last
+  /// one is handled without a wake-up. The window narrows while spins go
+  /// unanswered and widens again when events come just after it closed.
+  /// @c socketBusyPollMicroseconds also sets SO_BUSY_POLL on the
+  /// connections of this loop, see Socket::setBusyPoll().
+  /// 0 turns either off, the default.
+  /// Call before loop() or in the loop thread.
+  void setBusyPoll(int spinMicroseconds, int socketBusyPollMicroseconds = 0);
+  int socketBusyPoll() const { return socketBusyPollUs_; }
+
+  /// Where the loop has spent its waiting time, see setBusyPoll().
+  struct PollStats {
+    int64_t spinNs;    // in zero timeout polls
+    int64_t sleepNs;   // blocked in the poller
+    uint64_t spinHits; // spins that found work
+    uint64_t sleeps;   // times the loop blocked after spinning
+  };
+  /// Safe to call from other threads.
+  PollStats pollStats() const;
+
+  // timers, run in the loop thread, backed by a timerfd
+
+  ///
+  /// Runs callback at 'time'.
+  /// Safe to call from other threads.
+  ///
+  TimerId runAt(TimePoint time, TimerCallback cb);
+  ///
+  /// Runs callback after @c delay seconds.
+  /// Safe to call from other threads.
+  ///
+  TimerId runAfter(double delay, TimerCallback cb);
+  ///
+  /// Runs callback every @c interval seconds.
+  /// Safe to call from other threads.
+  ///
+  TimerId runEvery(double interval, TimerCallback cb);
+  ///
+  /// Cancels the timer.
+  /// Safe to call from other threads.
+  ///
+  void cancel(TimerId timerId);
+
   // internal usage
   void wakeup();
   void updateChannel(Channel *channel);
@@ -85,6 +135,7 @@ private:
   void abortNotInLoopThread();
   void handleRead(); // waked up
   void doPendingFunctors();
+  void busyPoll();
 
   void printActiveChannels() const; // DEBUG
 
@@ -96,6 +147,7 @@ private:
   bool callingPendingFunctors_; /* atomic */
   const std::thread::id threadId_;
   std::unique_ptr<Poller> poller_;
+  std::unique_ptr<TimerQueue> timerQueue_;
   int wakeupFd_;
   // we don't expose Channel to client.
   std::unique_ptr<Channel> wakeupChannel_;
@@ -103,8 +155,23 @@ private:
   // scratch variables
   ChannelList activeChannels_;
   Channel *currentActiveChannel_;
-  mutable std::mutex mutex_;
-  std::vector<Functor> pendingFunctors_;
+  // lock-free, only the loop thread drains it
+  MpscQueue<Functor> pendingFunctors_;
+  // set by the first producer after a drain, later ones skip the eventfd write
+  std::atomic<bool> wakeupPending_;
+
+  // busy polling, see setBusyPoll()
+  int spinMaxUs_;
+  int spinUs_; // current window
+  int socketBusyPollUs_;
+  // read by producers, who only look at spinning_ when it is set
+  std::atomic<bool> busyPollEnabled_;
+  // producers skip the eventfd write while we spin
+  std::atomic<bool> spinning_;
+  std::atomic<int64_t> spinNs_;
+  std::atomic<int64_t> sleepNs_;
+  std::atomic<uint64_t> spinHits_;
+  std::atomic<uint64_t> sleeps_;
 };
 } // namespace toyBasket
 
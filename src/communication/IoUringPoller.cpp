@@ -0,0 +1,457 @@
+/******************************************************************************
+ * File name     : IoUringPoller.cpp
+ * Description   :
+ * Version       : v1.0
+ * Create Time   : 2026/10/17
+ * Author        : andy
+ * Modify history:
+ *******************************************************************************
+ * Modify Time   Modify person  Modification
+ * ------------------------------------------------------------------------------
+ *
+ *******************************************************************************/
+#include "IoUringPoller.h"
+
+#include "Channel.h"
+#include "Types.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+using namespace toyBasket;
+
+const unsigned IoUringPoller::kRingEntries;
+
+// kernel headers older than 5.13 lack IORING_FEAT_EXT_ARG (5.11) or
+// IORING_POLL_ADD_MULTI (5.13), then the poller is built as a stub that
+// isSupported() never lets DefaultPoller pick
+#if defined(__NR_io_uring_setup) && defined(IORING_FEAT_EXT_ARG) && defined(IORING_POLL_ADD_MULTI) \
+    && defined(IORING_FEAT_RSRC_TAGS)
+
+namespace
+{
+const int kNew   = -1;
+const int kAdded = 1;
+
+// completions of POLL_REMOVE requests, nobody waits for them
+const uint64_t kIgnoredUserData = ~static_cast<uint64_t>(0);
+
+// IORING_FEAT_EXT_ARG for the wait timeout (5.11). Multishot poll has no
+// feature bit of its own, IORING_FEAT_RSRC_TAGS came with it in 5.13.
+const unsigned kRequiredFeatures = IORING_FEAT_EXT_ARG | IORING_FEAT_RSRC_TAGS;
+
+int ioUringSetup(unsigned entries, struct io_uring_params* params)
+{
+    return static_cast<int>(::syscall(__NR_io_uring_setup, entries, params));
+}
+
+int ioUringEnter(int fd, unsigned toSubmit, unsigned minComplete, unsigned flags, void* arg, size_t argSize)
+{
+    return static_cast<int>(::syscall(__NR_io_uring_enter, fd, toSubmit, minComplete, flags, arg, argSize));
+}
+
+void* mapRing(int fd, size_t size, off_t offset)
+{
+    void* p = ::mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, offset);
+    if (p == MAP_FAILED)
+    {
+        LOG_FATAL << "IoUringPoller mmap ring";
+    }
+    return p;
+}
+
+template <typename T> T* ringField(void* ring, unsigned offset)
+{
+    return reinterpret_cast<T*>(static_cast<char*>(ring) + offset);
+}
+} // namespace
+
+IoUringPoller::IoUringPoller(EventLoop* loop)
+    : Poller(loop)
+    , ringfd_(-1)
+    , sqRing_(NULL)
+    , sqRingSize_(0)
+    , cqRing_(NULL)
+    , cqRingSize_(0)
+    , sqes_(NULL)
+    , sqesSize_(0)
+    , sqHead_(NULL)
+    , sqTail_(NULL)
+    , sqArray_(NULL)
+    , sqMask_(0)
+    , sqEntries_(0)
+    , cqHead_(NULL)
+    , cqTail_(NULL)
+    , cqMask_(0)
+    , cqes_(NULL)
+{
+    struct io_uring_params params = {};
+    // room for a burst of multishot completions between two waits
+    params.flags      = IORING_SETUP_CQSIZE;
+    params.cq_entries = kRingEntries * 16;
+#ifdef IORING_SETUP_COOP_TASKRUN
+    params.flags |= IORING_SETUP_COOP_TASKRUN;
+    ringfd_ = ioUringSetup(kRingEntries, &params);
+    if (ringfd_ < 0 && errno == EINVAL)
+    {
+        // IORING_SETUP_COOP_TASKRUN is 5.19
+        params            = io_uring_params();
+        params.flags      = IORING_SETUP_CQSIZE;
+        params.cq_entries = kRingEntries * 16;
+        ringfd_           = ioUringSetup(kRingEntries, &params);
+    }
+#else
+    ringfd_ = ioUringSetup(kRingEntries, &params);
+#endif
+    if (ringfd_ < 0 || (params.features & kRequiredFeatures) != kRequiredFeatures)
+    {
+        LOG_FATAL << "IoUringPoller::IoUringPoller";
+    }
+
+    sqRingSize_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    cqRingSize_ = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    if (params.features & IORING_FEAT_SINGLE_MMAP)
+    {
+        sqRingSize_ = cqRingSize_ = std::max(sqRingSize_, cqRingSize_);
+        sqRing_ = cqRing_ = mapRing(ringfd_, sqRingSize_, IORING_OFF_SQ_RING);
+    }
+    else
+    {
+        sqRing_ = mapRing(ringfd_, sqRingSize_, IORING_OFF_SQ_RING);
+        cqRing_ = mapRing(ringfd_, cqRingSize_, IORING_OFF_CQ_RING);
+    }
+    sqesSize_ = params.sq_entries * sizeof(struct io_uring_sqe);
+    sqes_     = static_cast<struct io_uring_sqe*>(mapRing(ringfd_, sqesSize_, IORING_OFF_SQES));
+
+    sqHead_    = ringField<unsigned>(sqRing_, params.sq_off.head);
+    sqTail_    = ringField<unsigned>(sqRing_, params.sq_off.tail);
+    sqArray_   = ringField<unsigned>(sqRing_, params.sq_off.array);
+    sqMask_    = *ringField<unsigned>(sqRing_, params.sq_off.ring_mask);
+    sqEntries_ = *ringField<unsigned>(sqRing_, params.sq_off.ring_entries);
+    cqHead_    = ringField<unsigned>(cqRing_, params.cq_off.head);
+    cqTail_    = ringField<unsigned>(cqRing_, params.cq_off.tail);
+    cqMask_    = *ringField<unsigned>(cqRing_, params.cq_off.ring_mask);
+    cqes_      = ringField<struct io_uring_cqe>(cqRing_, params.cq_off.cqes);
+}
+
+IoUringPoller::~IoUringPoller()
+{
+    ::munmap(sqes_, sqesSize_);
+    if (cqRing_ != sqRing_)
+    {
+        ::munmap(cqRing_, cqRingSize_);
+    }
+    ::munmap(sqRing_, sqRingSize_);
+    ::close(ringfd_);
+}
+
+bool IoUringPoller::isSupported()
+{
+    static const bool supported = []() {
+        struct io_uring_params params = {};
+        int fd                        = ioUringSetup(1, &params);
+        if (fd < 0)
+        {
+            return false;
+        }
+        ::close(fd);
+        return (params.features & kRequiredFeatures) == kRequiredFeatures;
+    }();
+    return supported;
+}
+
+void IoUringPoller::poll(int timeoutMs, ChannelList* activeChannels)
+{
+    // busy polling calls this back to back with a zero timeout, keep quiet then
+    const bool verbose = timeoutMs != 0;
+    if (verbose)
+    {
+        LOG_INFO << "fd total count " << m_channels.size();
+    }
+    // one-shot polls that fired last round, unless the channel has been updated since
+    for (size_t i = 0; i < rearm_.size(); ++i)
+    {
+        const int fd = rearm_[i];
+        Slot& slot   = slots_[static_cast<size_t>(fd)];
+        if (slot.channel && !slot.armed && !slot.channel->isNoneEvent())
+        {
+            arm(fd, &slot);
+        }
+    }
+    rearm_.clear();
+
+    int savedErrno = 0;
+    if (enter(timeoutMs == 0 ? 0 : 1, timeoutMs, &savedErrno) < 0 && savedErrno != ETIME && savedErrno != EINTR)
+    {
+        errno = savedErrno;
+        LOG_ERROR << "IoUringPoller::poll()";
+    }
+    const size_t before = activeChannels->size();
+    fillActiveChannels(activeChannels);
+    if (!verbose)
+    {
+        return;
+    }
+    if (activeChannels->size() > before)
+    {
+        LOG_INFO << activeChannels->size() - before << " events happened";
+    }
+    else
+    {
+        LOG_INFO << "nothing happened";
+    }
+}
+
+void IoUringPoller::fillActiveChannels(ChannelList* activeChannels)
+{
+    const size_t first  = activeChannels->size();
+    unsigned head       = *cqHead_;
+    const unsigned tail = __atomic_load_n(cqTail_, __ATOMIC_ACQUIRE);
+    for (; head != tail; ++head)
+    {
+        const struct io_uring_cqe& cqe = cqes_[head & cqMask_];
+        if (cqe.user_data == kIgnoredUserData)
+        {
+            continue;
+        }
+        const size_t fd           = static_cast<size_t>(cqe.user_data & 0xffffffff);
+        const uint32_t generation = static_cast<uint32_t>(cqe.user_data >> 32);
+        if (fd >= slots_.size())
+        {
+            continue;
+        }
+        Slot& slot = slots_[fd];
+        if (!slot.channel || !slot.armed || slot.generation != generation)
+        {
+            // from a request we have removed or replaced since
+            continue;
+        }
+        if (!(cqe.flags & IORING_CQE_F_MORE))
+        {
+            slot.armed = false;
+            rearm_.push_back(static_cast<int>(fd));
+        }
+        if (cqe.res < 0)
+        {
+            errno = -cqe.res;
+            LOG_ERROR << "IoUringPoller poll fd = " << fd;
+            continue;
+        }
+        if (slot.active)
+        {
+            // a multishot poll may complete more than once per round
+            slot.revents |= cqe.res;
+        }
+        else
+        {
+            slot.active  = true;
+            slot.revents = cqe.res;
+            activeChannels->push_back(slot.channel);
+        }
+    }
+    __atomic_store_n(cqHead_, head, __ATOMIC_RELEASE);
+
+    for (size_t i = first; i < activeChannels->size(); ++i)
+    {
+        Channel* channel = (*activeChannels)[i];
+        Slot& slot       = slots_[static_cast<size_t>(channel->fd())];
+        channel->set_revents(slot.revents);
+        slot.active = false;
+    }
+}
+
+void IoUringPoller::updateChannel(Channel* channel)
+{
+    Poller::assertInLoopThread();
+    const int index = channel->index();
+    const int fd    = channel->fd();
+    LOG_INFO << "fd = " << fd << " events = " << channel->events() << " index = " << index;
+    if (index == kNew)
+    {
+        assert(m_channels.find(fd) == m_channels.end());
+        m_channels[fd] = channel;
+        channel->set_index(kAdded);
+        if (slots_.size() <= static_cast<size_t>(fd))
+        {
+            slots_.resize(static_cast<size_t>(fd) + 1, Slot());
+        }
+        slots_[static_cast<size_t>(fd)].channel = channel;
+    }
+    else
+    {
+        assert(m_channels.find(fd) != m_channels.end());
+        assert(m_channels[fd] == channel);
+        assert(index == kAdded);
+    }
+
+    Slot& slot = slots_[static_cast<size_t>(fd)];
+    if (slot.armed && slot.events == channel->events() && slot.multishot == channel->isEdgeTriggered())
+    {
+        return;
+    }
+    if (slot.armed)
+    {
+        disarm(fd, &slot);
+    }
+    if (!channel->isNoneEvent())
+    {
+        arm(fd, &slot);
+    }
+}
+
+void IoUringPoller::removeChannel(Channel* channel)
+{
+    Poller::assertInLoopThread();
+    const int fd = channel->fd();
+    LOG_INFO << "fd = " << fd;
+    assert(m_channels.find(fd) != m_channels.end());
+    assert(m_channels[fd] == channel);
+    assert(channel->isNoneEvent());
+    assert(channel->index() == kAdded);
+    size_t n = m_channels.erase(fd);
+    (void)n;
+    assert(n == 1);
+
+    Slot& slot = slots_[static_cast<size_t>(fd)];
+    if (slot.armed)
+    {
+        disarm(fd, &slot);
+    }
+    slot.channel = NULL;
+    slot.active  = false;
+    channel->set_index(kNew);
+    // a poll request holds the file, don't let it delay the close until the next wait
+    int savedErrno = 0;
+    if (enter(0, 0, &savedErrno) < 0)
+    {
+        errno = savedErrno;
+        LOG_ERROR << "IoUringPoller::removeChannel fd = " << fd;
+    }
+}
+
+uint64_t IoUringPoller::userData(int fd, uint32_t generation)
+{
+    return static_cast<uint64_t>(generation) << 32 | static_cast<uint32_t>(fd);
+}
+
+void IoUringPoller::arm(int fd, Slot* slot)
+{
+    struct io_uring_sqe* sqe = getSqe();
+    ++slot->generation;
+    slot->events       = slot->channel->events();
+    slot->multishot    = slot->channel->isEdgeTriggered();
+    slot->armed        = true;
+    sqe->opcode        = IORING_OP_POLL_ADD;
+    sqe->fd            = fd;
+    sqe->poll32_events = static_cast<uint32_t>(slot->events);
+    sqe->len           = slot->multishot ? IORING_POLL_ADD_MULTI : 0;
+    sqe->user_data     = userData(fd, slot->generation);
+}
+
+void IoUringPoller::disarm(int fd, Slot* slot)
+{
+    struct io_uring_sqe* sqe = getSqe();
+    slot->armed              = false;
+    sqe->opcode              = IORING_OP_POLL_REMOVE;
+    sqe->fd                  = -1;
+    sqe->addr                = userData(fd, slot->generation);
+    sqe->user_data           = kIgnoredUserData;
+}
+
+struct io_uring_sqe* IoUringPoller::getSqe()
+{
+    // no SQPOLL thread, the kernel only reads entries in io_uring_enter()
+    unsigned tail = *sqTail_;
+    if (tail - __atomic_load_n(sqHead_, __ATOMIC_ACQUIRE) == sqEntries_)
+    {
+        int savedErrno = 0;
+        if (enter(0, 0, &savedErrno) < 0)
+        {
+            errno = savedErrno;
+            LOG_FATAL << "IoUringPoller submission queue full";
+        }
+        tail = *sqTail_;
+    }
+    const unsigned index     = tail & sqMask_;
+    struct io_uring_sqe* sqe = &sqes_[index];
+    ::memset(sqe, 0, sizeof(*sqe));
+    sqArray_[index] = index;
+    __atomic_store_n(sqTail_, tail + 1, __ATOMIC_RELEASE);
+    return sqe;
+}
+
+int IoUringPoller::enter(unsigned minComplete, int timeoutMs, int* savedErrno)
+{
+    const unsigned toSubmit           = *sqTail_ - __atomic_load_n(sqHead_, __ATOMIC_ACQUIRE);
+    struct __kernel_timespec ts       = {};
+    struct io_uring_getevents_arg arg = {};
+    arg.sigmask_sz                    = _NSIG / 8;
+    if (timeoutMs >= 0)
+    {
+        ts.tv_sec  = timeoutMs / 1000;
+        ts.tv_nsec = static_cast<long long>(timeoutMs % 1000) * 1000 * 1000;
+        arg.ts     = reinterpret_cast<uint64_t>(&ts);
+    }
+    // GETEVENTS also runs the completions the kernel has deferred to us
+    const int ret = ioUringEnter(ringfd_, toSubmit, minComplete, IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG,
+                                 &arg, sizeof(arg));
+    if (ret < 0)
+    {
+        *savedErrno = errno;
+    }
+    return ret;
+}
+
+#else
+
+IoUringPoller::IoUringPoller(EventLoop* loop)
+    : Poller(loop)
+    , ringfd_(-1)
+    , sqRing_(NULL)
+    , sqRingSize_(0)
+    , cqRing_(NULL)
+    , cqRingSize_(0)
+    , sqes_(NULL)
+    , sqesSize_(0)
+    , sqHead_(NULL)
+    , sqTail_(NULL)
+    , sqArray_(NULL)
+    , sqMask_(0)
+    , sqEntries_(0)
+    , cqHead_(NULL)
+    , cqTail_(NULL)
+    , cqMask_(0)
+    , cqes_(NULL)
+{
+    LOG_FATAL << "IoUringPoller: built with kernel headers without io_uring poll support";
+}
+
+IoUringPoller::~IoUringPoller()
+{
+}
+
+bool IoUringPoller::isSupported()
+{
+    return false;
+}
+
+void IoUringPoller::poll(int, ChannelList*)
+{
+}
+
+void IoUringPoller::updateChannel(Channel*)
+{
+}
+
+void IoUringPoller::removeChannel(Channel*)
+{
+}
+
+#endif
@@ -0,0 +1,98 @@
+/******************************************************************************
+ * File name     : IoUringPoller.h
+ * Description   :
+ * Version       : v1.0
+ * Create Time   : 2026/10/17
+ * Author        : andy
+ * Modify history:
+ *******************************************************************************
+ * Modify Time   Modify person  Modification
+ * ------------------------------------------------------------------------------
+ *
+ *******************************************************************************/
+
+#ifndef _POLLER_IOURINGPOLLER_H
+#define _POLLER_IOURINGPOLLER_H
+
+#include "Poller.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+namespace toyBasket
+{
+
+///
+/// IO Multiplexing with io_uring(7) poll requests.
+///
+/// Interest changes become submission queue entries and reach the kernel
+/// together with the wait, one io_uring_enter(2) per loop iteration instead
+/// of one epoll_ctl(2) per change. Edge triggered channels get a multishot
+/// poll that stays armed, the others a one-shot poll that is armed again
+/// before the next wait, which keeps them level triggered.
+///
+/// Needs Linux 5.13 or later, see isSupported().
+class IoUringPoller : public Poller
+{
+public:
+    IoUringPoller(EventLoop* loop);
+    ~IoUringPoller() override;
+
+    void poll(int timeoutMs, ChannelList* activeChannels) override;
+    void updateChannel(Channel* channel) override;
+    void removeChannel(Channel* channel) override;
+
+    /// Whether the running kernel can back this poller.
+    static bool isSupported();
+
+private:
+    static const unsigned kRingEntries = 256;
+
+    /// Poll request of one fd.
+    struct Slot
+    {
+        Channel* channel;
+        uint32_t generation; // tags the user_data of the current request
+        int events;          // what the current request waits for
+        int revents;         // collected this round
+        bool armed;
+        bool multishot;
+        bool active; // already in activeChannels this round
+    };
+
+    static uint64_t userData(int fd, uint32_t generation);
+
+    void arm(int fd, Slot* slot);
+    void disarm(int fd, Slot* slot);
+    io_uring_sqe* getSqe();
+    /// @return result of io_uring_enter(2), @c errno is saved
+    int enter(unsigned minComplete, int timeoutMs, int* savedErrno);
+    void fillActiveChannels(ChannelList* activeChannels);
+
+    int ringfd_;
+    void* sqRing_;
+    size_t sqRingSize_;
+    void* cqRing_; // same as sqRing_ with IORING_FEAT_SINGLE_MMAP
+    size_t cqRingSize_;
+    io_uring_sqe* sqes_;
+    size_t sqesSize_;
+    unsigned* sqHead_;
+    unsigned* sqTail_;
+    unsigned* sqArray_;
+    unsigned sqMask_;
+    unsigned sqEntries_;
+    unsigned* cqHead_;
+    unsigned* cqTail_;
+    unsigned cqMask_;
+    io_uring_cqe* cqes_;
+
+    std::vector<Slot> slots_; // indexed by fd
+    std::vector<int> rearm_;  // fds whose one-shot poll fired last round
+};
+
+} // namespace toyBasket
+#endif // _POLLER_IOURINGPOLLER_H
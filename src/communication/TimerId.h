@@ -0,0 +1,58 @@
+/******************************************************************************
+ * File name     : TimerId.h
+ * Description   :
+ * Version       : v1.0
+ * Create Time   : 2026/10/17
+ * Author        : andy
+ * Modify history:
+ *******************************************************************************
+ * Modify Time   Modify person  Modification
+ * ------------------------------------------------------------------------------
+ *
+ *******************************************************************************/
+
+#ifndef _TIMERID_H
+#define _TIMERID_H
+
+#include <stdint.h>
+
+namespace toyBasket
+{
+
+class LoopTimer;
+
+///
+/// An opaque identifier, for canceling Timer.
+///
+class TimerId
+{
+public:
+    TimerId()
+        : timer_(NULL)
+        , sequence_(0)
+    {
+    }
+
+    TimerId(LoopTimer* timer, int64_t seq)
+        : timer_(timer)
+        , sequence_(seq)
+    {
+    }
+
+    // default copy-ctor, dtor and assignment are okay
+
+    bool valid() const
+    {
+        return timer_ != NULL;
+    }
+
+    friend class TimerQueue;
+
+private:
+    LoopTimer* timer_;
+    int64_t sequence_;
+};
+
+} // namespace toyBasket
+
+#endif // _TIMERID_H
@@ -0,0 +1,259 @@
+/******************************************************************************
+ * File name     : TimerQueue.cpp
+ * Description   :
+ * Version       : v1.0
+ * Create Time   : 2026/10/17
+ * Author        : andy
+ * Modify history:
+ *******************************************************************************
+ * Modify Time   Modify person  Modification
+ * ------------------------------------------------------------------------------
+ *
+ *******************************************************************************/
+
+#include "TimerQueue.h"
+
+#include "EventLoop.h"
+#include "Types.h"
+
+#include <cassert>
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+using namespace toyBasket;
+
+std::atomic<int64_t> LoopTimer::s_numCreated_(0);
+
+namespace
+{
+
+int createTimerfd()
+{
+    int timerfd = ::timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    if (timerfd < 0)
+    {
+        LOG_FATAL << "Failed in timerfd_create";
+    }
+    return timerfd;
+}
+
+// steady_clock is CLOCK_MONOTONIC on Linux, so an expiration can be
+// handed to timerfd as a relative timeout without any clock conversion.
+struct timespec howMuchTimeFromNow(TimePoint when)
+{
+    int64_t nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(when - Clock::now()).count();
+    if (nanoseconds < 100 * 1000)
+    {
+        nanoseconds = 100 * 1000;
+    }
+    struct timespec ts;
+    ts.tv_sec  = static_cast<time_t>(nanoseconds / (1000 * 1000 * 1000));
+    ts.tv_nsec = static_cast<long>(nanoseconds % (1000 * 1000 * 1000));
+    return ts;
+}
+
+void readTimerfd(int timerfd)
+{
+    uint64_t howmany;
+    ssize_t n = ::read(timerfd, &howmany, sizeof howmany);
+    if (n != sizeof howmany)
+    {
+        LOG_ERROR << "TimerQueue::handleRead() reads " << n << " bytes instead of 8";
+    }
+}
+
+void resetTimerfd(int timerfd, TimePoint expiration)
+{
+    // wake up loop by timerfd_settime()
+    struct itimerspec newValue = {};
+    struct itimerspec oldValue = {};
+    newValue.it_value          = howMuchTimeFromNow(expiration);
+    int ret                    = ::timerfd_settime(timerfd, 0, &newValue, &oldValue);
+    if (ret)
+    {
+        LOG_ERROR << "timerfd_settime()";
+    }
+}
+
+} // namespace
+
+LoopTimer::LoopTimer(TimerCallback cb, TimePoint when, double interval)
+    : callback_(std::move(cb))
+    , expiration_(when)
+    , interval_(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::duration<double>(interval)))
+    , repeat_(interval > 0.0)
+    , sequence_(++s_numCreated_)
+{
+}
+
+void LoopTimer::restart(TimePoint now)
+{
+    if (repeat_)
+    {
+        expiration_ = now + interval_;
+    }
+    else
+    {
+        expiration_ = TimePoint();
+    }
+}
+
+TimerQueue::TimerQueue(EventLoop* loop)
+    : loop_(loop)
+    , timerfd_(createTimerfd())
+    , timerfdChannel_(loop, timerfd_)
+    , timers_()
+    , callingExpiredTimers_(false)
+{
+    timerfdChannel_.setReadCallback(std::bind(&TimerQueue::handleRead, this));
+    // we are always reading the timerfd, we disarm it with timerfd_settime.
+    timerfdChannel_.enableReading();
+}
+
+TimerQueue::~TimerQueue()
+{
+    timerfdChannel_.disableAll();
+    timerfdChannel_.remove();
+    ::close(timerfd_);
+}
+
+TimerId TimerQueue::addTimer(TimerCallback cb, TimePoint when, double interval)
+{
+    // handed over as a raw pointer since the functor must be copyable,
+    // addTimerInLoop takes ownership
+    LoopTimer* timer = new LoopTimer(std::move(cb), when, interval);
+    loop_->runInLoop(std::bind(&TimerQueue::addTimerInLoop, this, timer));
+    return TimerId(timer, timer->sequence());
+}
+
+void TimerQueue::cancel(TimerId timerId)
+{
+    loop_->runInLoop(std::bind(&TimerQueue::cancelInLoop, this, timerId));
+}
+
+void TimerQueue::addTimerInLoop(LoopTimer* timer)
+{
+    loop_->assertInLoopThread();
+    TimePoint when       = timer->expiration();
+    bool earliestChanged = insert(std::unique_ptr<LoopTimer>(timer));
+
+    if (earliestChanged)
+    {
+        resetTimerfd(timerfd_, when);
+    }
+}
+
+void TimerQueue::cancelInLoop(TimerId timerId)
+{
+    loop_->assertInLoopThread();
+    assert(timers_.size() == activeTimers_.size());
+    ActiveTimer timer(timerId.timer_, timerId.sequence_);
+    ActiveTimerMap::iterator it = activeTimers_.find(timer);
+    if (it != activeTimers_.end())
+    {
+        size_t n = timers_.erase(Entry(it->second->expiration(), it->second.get()));
+        assert(n == 1);
+        (void)n;
+        activeTimers_.erase(it);
+    }
+    else if (callingExpiredTimers_)
+    {
+        // cancelled from inside its own callback, don't restart it
+        cancelingTimers_.insert(timer);
+    }
+    assert(timers_.size() == activeTimers_.size());
+}
+
+void TimerQueue::handleRead()
+{
+    loop_->assertInLoopThread();
+    TimePoint now(Clock::now());
+    readTimerfd(timerfd_);
+
+    TimerVector expired = getExpired(now);
+
+    callingExpiredTimers_ = true;
+    cancelingTimers_.clear();
+    // safe to callback outside critical section
+    for (const std::unique_ptr<LoopTimer>& timer : expired)
+    {
+        timer->run();
+    }
+    callingExpiredTimers_ = false;
+
+    reset(expired, now);
+}
+
+TimerQueue::TimerVector TimerQueue::getExpired(TimePoint now)
+{
+    assert(timers_.size() == activeTimers_.size());
+    TimerVector expired;
+    Entry sentry(now, reinterpret_cast<LoopTimer*>(UINTPTR_MAX));
+    TimerList::iterator end = timers_.lower_bound(sentry);
+    assert(end == timers_.end() || now < end->first);
+
+    for (TimerList::iterator it = timers_.begin(); it != end; ++it)
+    {
+        ActiveTimerMap::iterator active = activeTimers_.find(ActiveTimer(it->second, it->second->sequence()));
+        assert(active != activeTimers_.end());
+        expired.push_back(std::move(active->second));
+        activeTimers_.erase(active);
+    }
+    timers_.erase(timers_.begin(), end);
+
+    assert(timers_.size() == activeTimers_.size());
+    return expired;
+}
+
+void TimerQueue::reset(TimerVector& expired, TimePoint now)
+{
+    TimePoint nextExpire;
+
+    // timers not put back are freed along with expired
+    for (std::unique_ptr<LoopTimer>& it : expired)
+    {
+        ActiveTimer timer(it.get(), it->sequence());
+        if (it->repeat() && cancelingTimers_.find(timer) == cancelingTimers_.end())
+        {
+            it->restart(now);
+            insert(std::move(it));
+        }
+    }
+
+    if (!timers_.empty())
+    {
+        nextExpire = timers_.begin()->second->expiration();
+    }
+
+    if (nextExpire != TimePoint())
+    {
+        resetTimerfd(timerfd_, nextExpire);
+    }
+}
+
+bool TimerQueue::insert(std::unique_ptr<LoopTimer> timer)
+{
+    loop_->assertInLoopThread();
+    assert(timers_.size() == activeTimers_.size());
+    bool earliestChanged   = false;
+    TimePoint when         = timer->expiration();
+    TimerList::iterator it = timers_.begin();
+    if (it == timers_.end() || when < it->first)
+    {
+        earliestChanged = true;
+    }
+    {
+        std::pair<TimerList::iterator, bool> result = timers_.insert(Entry(when, timer.get()));
+        assert(result.second);
+        (void)result;
+    }
+    {
+        ActiveTimer key(timer.get(), timer->sequence());
+        std::pair<ActiveTimerMap::iterator, bool> result = activeTimers_.insert(std::make_pair(key, std::move(timer)));
+        assert(result.second);
+        (void)result;
+    }
+
+    assert(timers_.size() == activeTimers_.size());
+    return earliestChanged;
+}
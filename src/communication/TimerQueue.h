@@ -0,0 +1,123 @@
+/******************************************************************************
+ * File name     : TimerQueue.h
+ * Description   :
+ * Version       : v1.0
+ * Create Time   : 2026/10/17
+ * Author        : andy
+ * Modify history:
+ *******************************************************************************
+ * Modify Time   Modify person  Modification
+ * ------------------------------------------------------------------------------
+ *
+ *******************************************************************************/
+
+#ifndef _TIMERQUEUE_H
+#define _TIMERQUEUE_H
+
+#include "Callbacks.h"
+#include "Channel.h"
+#include "TimerId.h"
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <set>
+#include <vector>
+
+namespace toyBasket
+{
+
+class EventLoop;
+
+///
+/// Internal class for timer event, owned by TimerQueue.
+///
+class LoopTimer : noncopyable
+{
+public:
+    LoopTimer(TimerCallback cb, TimePoint when, double interval);
+
+    void run() const
+    {
+        callback_();
+    }
+
+    TimePoint expiration() const
+    {
+        return expiration_;
+    }
+    bool repeat() const
+    {
+        return repeat_;
+    }
+    int64_t sequence() const
+    {
+        return sequence_;
+    }
+
+    void restart(TimePoint now);
+
+private:
+    const TimerCallback callback_;
+    TimePoint expiration_;
+    const std::chrono::nanoseconds interval_;
+    const bool repeat_;
+    const int64_t sequence_;
+
+    static std::atomic<int64_t> s_numCreated_;
+};
+
+///
+/// A best efforts timer queue.
+/// No guarantee that the callback will be on time.
+///
+/// Backed by a timerfd, so callbacks run in the loop thread
+/// together with the other channels of that loop.
+class TimerQueue : noncopyable
+{
+public:
+    explicit TimerQueue(EventLoop* loop);
+    ~TimerQueue();
+
+    ///
+    /// Schedules the callback to be run at given time,
+    /// repeats if @c interval > 0.0.
+    ///
+    /// Must be thread safe. Usually be called from other threads.
+    TimerId addTimer(TimerCallback cb, TimePoint when, double interval);
+
+    void cancel(TimerId timerId);
+
+private:
+    typedef std::pair<TimePoint, LoopTimer*> Entry;
+    typedef std::set<Entry> TimerList;
+    typedef std::pair<LoopTimer*, int64_t> ActiveTimer;
+    typedef std::set<ActiveTimer> ActiveTimerSet;
+    typedef std::map<ActiveTimer, std::unique_ptr<LoopTimer>> ActiveTimerMap;
+    typedef std::vector<std::unique_ptr<LoopTimer>> TimerVector;
+
+    void addTimerInLoop(LoopTimer* timer);
+    void cancelInLoop(TimerId timerId);
+    // called when timerfd alarms
+    void handleRead();
+    // move out all expired timers, the caller owns them until reset()
+    TimerVector getExpired(TimePoint now);
+    void reset(TimerVector& expired, TimePoint now);
+
+    bool insert(std::unique_ptr<LoopTimer> timer);
+
+    EventLoop* loop_;
+    const int timerfd_;
+    Channel timerfdChannel_;
+    // Timer list sorted by expiration
+    TimerList timers_;
+
+    // owns the timers in timers_, also for cancel()
+    ActiveTimerMap activeTimers_;
+    bool callingExpiredTimers_; /* atomic */
+    ActiveTimerSet cancelingTimers_;
+};
+
+} // namespace toyBasket
+
+#endif // _TIMERQUEUE_H
@@ -19,6 +19,7 @@
 
 #include <cassert>
 #include <cerrno>
+#include <cstring>
 #include <fcntl.h>
 #include <sys/socket.h>
 #include <sys/types.h>
@@ -58,6 +59,23 @@ void Acceptor::listen()
     acceptChannel_.enableReading();
 }
 
+InetAddress Acceptor::localAddress() const
+{
+    struct sockaddr_in6 addr = {};
+    socklen_t addrlen        = static_cast<socklen_t>(sizeof addr);
+    if (::getsockname(acceptSocket_.fd(), reinterpret_cast<struct ::sockaddr*>(&addr), &addrlen) < 0)
+    {
+        LOG_ERROR << "Acceptor::localAddress: " << strerror(errno);
+    }
+    if (addr.sin6_family == AF_INET)
+    {
+        struct sockaddr_in addr4 = {};
+        ::memcpy(&addr4, &addr, sizeof addr4);
+        return InetAddress(addr4);
+    }
+    return InetAddress(addr);
+}
+
 void Acceptor::handleRead()
 {
     loop_->assertInLoopThread();
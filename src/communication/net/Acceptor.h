@@ -45,7 +45,14 @@ public:
     {
         return listenning_;
     }
+    EventLoop* ownerLoop() const
+    {
+        return loop_;
+    }
     void listen();
+    /// The address the socket is bound to, with the port the kernel picked
+    /// when it was bound to port 0.
+    InetAddress localAddress() const;
 
 private:
     void handleRead();
@@ -0,0 +1,75 @@
+/******************************************************************************
+ * File name     : BufferAccount.h
+ * Description   :
+ * Version       : v1.0
+ * Create Time   : 2026/10/17
+ * Author        : andy
+ * Modify history:
+ *******************************************************************************
+ * Modify Time   Modify person  Modification
+ * ------------------------------------------------------------------------------
+ *
+ *******************************************************************************/
+
+#ifndef _BUFFERACCOUNT_H
+#define _BUFFERACCOUNT_H
+
+#include "noncopyable.h"
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace toyBasket
+{
+
+/// Bytes waiting in the input and output buffers of a group of
+/// connections, usually all connections of one StreamServer.
+///
+/// Connections on any I/O thread report their changes; when a limit is
+/// set and reached, they stop reading until the total drops below it.
+class BufferAccount : noncopyable
+{
+public:
+    explicit BufferAccount(size_t limit = 0)
+        : limit_(limit)
+        , bytes_(0)
+    {
+    }
+
+    /// 0 means no limit. Thread safe.
+    void setLimit(size_t limit)
+    {
+        limit_.store(limit, std::memory_order_relaxed);
+    }
+
+    size_t limit() const
+    {
+        return limit_.load(std::memory_order_relaxed);
+    }
+
+    size_t bytes() const
+    {
+        int64_t bytes = bytes_.load(std::memory_order_relaxed);
+        return bytes > 0 ? static_cast<size_t>(bytes) : 0;
+    }
+
+    bool overLimit() const
+    {
+        size_t limit = limit_.load(std::memory_order_relaxed);
+        return limit > 0 && bytes() >= limit;
+    }
+
+    void add(int64_t delta)
+    {
+        bytes_.fetch_add(delta, std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<size_t> limit_;
+    std::atomic<int64_t> bytes_;
+};
+
+} // namespace toyBasket
+
+#endif // _BUFFERACCOUNT_H
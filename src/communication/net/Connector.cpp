@@ -15,7 +15,6 @@
 
 #include "Channel.h"
 #include "EventLoop.h"
-#include "Timer.h"
 #include "Types.h"
 
 #include <cassert>
@@ -65,7 +64,7 @@ void Connector::stop()
 {
     connect_ = false;
     loop_->queueInLoop(std::bind(&Connector::stopInLoop, this)); // FIXME: unsafe
-                                                                 // FIXME: cancel timer
+    loop_->cancel(timerId_);
 }
 
 void Connector::stopInLoop()
@@ -249,8 +248,7 @@ void Connector::retry(int sockfd)
     {
         LOG_INFO << "Connector::retry - Retry connecting to " << serverAddr_.toString() << " in " << retryDelayMs_
                  << " milliseconds. ";
-        TimerManager::getInstance()->addTimer(static_cast<unsigned int>(retryDelayMs_),
-                                              std::bind(&Connector::startInLoop, shared_from_this()));
+        timerId_ = loop_->runAfter(retryDelayMs_ / 1000.0, std::bind(&Connector::startInLoop, shared_from_this()));
         retryDelayMs_ = std::min(retryDelayMs_ * 2, kMaxRetryDelayMs);
     }
     else
@@ -293,4 +291,4 @@ bool Connector::isSelfConnect(int sockfd)
     {
         return false;
     }
-}
\ No newline at end of file
+}
\ No newline at end of file
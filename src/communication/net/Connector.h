@@ -16,6 +16,7 @@
 
 #include "noncopyable.h"
 #include "InetAddress.h"
+#include "TimerId.h"
 
 #include <functional>
 #include <memory>
@@ -80,6 +81,7 @@ private:
     std::unique_ptr<Channel> channel_;
     NewConnectionCallback newConnectionCallback_;
     int retryDelayMs_;
+    TimerId timerId_;
 };
 
 } // namespace toyBasket
@@ -0,0 +1,66 @@
+/******************************************************************************
+ * File name     : DgramReceiver.cpp
+ * Description   :
+ * Version       : v1.0
+ * Create Time   : 2026/10/17
+ * Author        : andy
+ * Modify history:
+ *******************************************************************************
+ * Modify Time   Modify person  Modification
+ * ------------------------------------------------------------------------------
+ *
+ *******************************************************************************/
+
+#include "DgramReceiver.h"
+
+#include <cassert>
+#include <cstring>
+#include <sys/uio.h>
+
+using namespace toyBasket;
+
+const int DgramReceiver::kDefaultBatchSize;
+const int DgramReceiver::kMaxBatchesPerRead;
+
+DgramReceiver::DgramReceiver(int batchSize, size_t bufferSize)
+    : bufferSize_(bufferSize)
+    , buffers_(static_cast<size_t>(batchSize) * bufferSize)
+    , iovecs_(static_cast<size_t>(batchSize))
+    , addrs_(static_cast<size_t>(batchSize))
+    , msgs_(static_cast<size_t>(batchSize))
+    , datagrams_(static_cast<size_t>(batchSize))
+{
+    assert(batchSize > 0);
+    for (size_t i = 0; i < msgs_.size(); ++i)
+    {
+        iovecs_[i].iov_base = &buffers_[i * bufferSize_];
+        iovecs_[i].iov_len  = bufferSize_;
+        datagrams_[i].data  = &buffers_[i * bufferSize_];
+        datagrams_[i].len   = 0;
+    }
+}
+
+int DgramReceiver::receive(int fd)
+{
+    // recvmmsg overwrites msg_namelen and msg_len, reset the headers every time
+    memset(&*msgs_.begin(), 0, msgs_.size() * sizeof(struct mmsghdr));
+    for (size_t i = 0; i < msgs_.size(); ++i)
+    {
+        msgs_[i].msg_hdr.msg_name    = &addrs_[i];
+        msgs_[i].msg_hdr.msg_namelen = sizeof(struct sockaddr_un);
+        msgs_[i].msg_hdr.msg_iov     = &iovecs_[i];
+        msgs_[i].msg_hdr.msg_iovlen  = 1;
+    }
+
+    int n = ::recvmmsg(fd, &*msgs_.begin(), static_cast<unsigned int>(msgs_.size()), MSG_DONTWAIT, NULL);
+    for (int i = 0; i < n; ++i)
+    {
+        if (msgs_[i].msg_hdr.msg_flags & MSG_TRUNC)
+        {
+            LOG_WARNING << "datagram truncated to " << bufferSize_ << " bytes";
+        }
+        datagrams_[i].peerAddr.setSockAddr(addrs_[i]);
+        datagrams_[i].len = static_cast<int>(msgs_[i].msg_len);
+    }
+    return n;
+}
@@ -0,0 +1,88 @@
+/******************************************************************************
+ * File name     : DgramReceiver.h
+ * Description   :
+ * Version       : v1.0
+ * Create Time   : 2026/10/17
+ * Author        : andy
+ * Modify history:
+ *******************************************************************************
+ * Modify Time   Modify person  Modification
+ * ------------------------------------------------------------------------------
+ *
+ *******************************************************************************/
+
+#ifndef _DGRAMRECEIVER_H
+#define _DGRAMRECEIVER_H
+
+#include "Callbacks.h"
+#include "InetAddress.h"
+#include "Types.h"
+#include "noncopyable.h"
+
+#include <vector>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+
+namespace toyBasket
+{
+
+/// One received datagram, @c data points into the receiver's buffers and
+/// is valid until the next receive().
+struct Datagram
+{
+    InetAddress peerAddr;
+    const char* data;
+    int len;
+};
+
+///
+/// Batched datagram receive with recvmmsg(2).
+///
+/// All buffers are allocated once, a receive() fills them in place and
+/// hands out a contiguous array of Datagram.
+class DgramReceiver : noncopyable
+{
+public:
+    static const int kDefaultBatchSize  = 64;
+    // batches a reader drains per readiness event before going back to poll
+    static const int kMaxBatchesPerRead = 16;
+
+    explicit DgramReceiver(int batchSize = kDefaultBatchSize, size_t bufferSize = MSG_BUF_SIZE);
+
+    /// Receives up to batchSize() datagrams from @c fd with one syscall.
+    ///
+    /// @return number of datagrams, -1 on error with errno set
+    int receive(int fd);
+
+    const Datagram* datagrams() const
+    {
+        return &*datagrams_.begin();
+    }
+
+    int batchSize() const
+    {
+        return static_cast<int>(msgs_.size());
+    }
+
+    /// Feeds a batch to a per-packet callback.
+    static void forEach(const Datagram* datagrams, int count, const DgramEventCallback& cb)
+    {
+        for (int i = 0; i < count; ++i)
+        {
+            cb(datagrams[i].peerAddr, datagrams[i].data, datagrams[i].len);
+        }
+    }
+
+private:
+    const size_t bufferSize_;
+    std::vector<char> buffers_;
+    std::vector<struct iovec> iovecs_;
+    std::vector<struct sockaddr_un> addrs_;
+    std::vector<struct mmsghdr> msgs_;
+    std::vector<Datagram> datagrams_;
+};
+
+} // namespace toyBasket
+
+#endif // _DGRAMRECEIVER_H
@@ -0,0 +1,186 @@
+/******************************************************************************
+ * File name     : DgramSender.cpp
+ * Description   :
+ * Version       : v1.0
+ * Create Time   : 2026/10/17
+ * Author        : andy
+ * Modify history:
+ *******************************************************************************
+ * Modify Time   Modify person  Modification
+ * ------------------------------------------------------------------------------
+ *
+ *******************************************************************************/
+
+#include "DgramSender.h"
+#include "Types.h"
+
+#include <cerrno>
+#include <cstring>
+#include <netinet/udp.h>
+#include <sys/uio.h>
+
+#ifndef UDP_SEGMENT
+#define UDP_SEGMENT 103
+#endif
+
+using namespace toyBasket;
+
+const int DgramSender::kMaxMessages;
+const int DgramSender::kMaxSegments;
+const int DgramSender::kMaxSegmentSize;
+const size_t DgramSender::kMaxGsoBytes;
+const size_t DgramSender::kHighWater;
+
+namespace
+{
+
+const size_t kControlSpace = CMSG_SPACE(sizeof(uint16_t));
+
+bool samePeer(const InetAddress& lhs, const InetAddress& rhs)
+{
+    return lhs.getSockLen() == rhs.getSockLen() && memcmp(lhs.getSockAddr(), rhs.getSockAddr(), lhs.getSockLen()) == 0;
+}
+
+} // namespace
+
+DgramSender::DgramSender()
+    : gso_(false)
+    , msgs_(kMaxMessages)
+    , iovecs_(kMaxMessages)
+    , control_(kMaxMessages * kControlSpace)
+    , segments_(kMaxMessages)
+{
+}
+
+void DgramSender::append(const InetAddress& peerAddr, const void* data, int len)
+{
+    Entry entry = { peerAddr, buffer_.size(), len };
+    buffer_.insert(buffer_.end(), static_cast<const char*>(data), static_cast<const char*>(data) + len);
+    entries_.push_back(entry);
+}
+
+size_t DgramSender::gsoRun(size_t first) const
+{
+    const Entry& head = entries_[first];
+    if (!gso_ || head.len <= 0 || head.len > kMaxSegmentSize)
+    {
+        return 1;
+    }
+
+    size_t count = 1;
+    size_t bytes = static_cast<size_t>(head.len);
+    while (first + count < entries_.size() && count < static_cast<size_t>(kMaxSegments))
+    {
+        const Entry& next = entries_[first + count];
+        // every segment but the last one must be exactly gso_size long
+        if (next.len <= 0 || next.len > head.len || bytes + static_cast<size_t>(next.len) > kMaxGsoBytes
+            || !samePeer(head.peerAddr, next.peerAddr))
+        {
+            break;
+        }
+        bytes += static_cast<size_t>(next.len);
+        ++count;
+        if (next.len < head.len)
+        {
+            break;
+        }
+    }
+    return count;
+}
+
+int DgramSender::flush(int fd)
+{
+    int sent    = 0;
+    size_t next = 0;
+    while (next < entries_.size())
+    {
+        // build up to kMaxMessages headers starting at entry 'next'
+        size_t first   = next;
+        unsigned int n = 0;
+        memset(&*msgs_.begin(), 0, msgs_.size() * sizeof(struct mmsghdr));
+        while (next < entries_.size() && n < static_cast<unsigned int>(kMaxMessages))
+        {
+            const Entry& entry = entries_[next];
+            size_t count       = gsoRun(next);
+            size_t bytes       = 0;
+            for (size_t i = next; i < next + count; ++i)
+            {
+                bytes += static_cast<size_t>(entries_[i].len);
+            }
+
+            // entries are laid out back to back, one iovec covers the run
+            iovecs_[n].iov_base = &buffer_[entry.offset];
+            iovecs_[n].iov_len  = bytes;
+
+            struct msghdr& hdr = msgs_[n].msg_hdr;
+            hdr.msg_name       = const_cast<struct sockaddr*>(entry.peerAddr.getSockAddr());
+            hdr.msg_namelen    = entry.peerAddr.getSockLen();
+            hdr.msg_iov        = &iovecs_[n];
+            hdr.msg_iovlen     = 1;
+            if (count > 1)
+            {
+                hdr.msg_control    = &control_[n * kControlSpace];
+                hdr.msg_controllen = kControlSpace;
+                struct cmsghdr* cm = CMSG_FIRSTHDR(&hdr);
+                cm->cmsg_level     = SOL_UDP;
+                cm->cmsg_type      = UDP_SEGMENT;
+                cm->cmsg_len       = CMSG_LEN(sizeof(uint16_t));
+                uint16_t gsoSize   = static_cast<uint16_t>(entry.len);
+                memcpy(CMSG_DATA(cm), &gsoSize, sizeof gsoSize);
+            }
+            segments_[n] = count;
+            next += count;
+            ++n;
+        }
+
+        int ret = ::sendmmsg(fd, &*msgs_.begin(), n, 0);
+        if (ret < 0)
+        {
+            int savedErrno = errno;
+            bool usedGso   = false;
+            for (unsigned int i = 0; i < n && !usedGso; ++i)
+            {
+                usedGso = segments_[i] > 1;
+            }
+            if (usedGso && (savedErrno == EIO || savedErrno == EINVAL || savedErrno == ENOPROTOOPT))
+            {
+                LOG_WARNING << "UDP GSO not supported here (" << strerror(savedErrno) << "), disabled";
+                gso_ = false;
+                next = first;
+                continue;
+            }
+
+            if (savedErrno == EINTR)
+            {
+                next = first;
+                continue;
+            }
+            if (savedErrno == EAGAIN || savedErrno == EWOULDBLOCK)
+            {
+                LOG_ERROR << "sendmmsg error: " << strerror(savedErrno) << ", " << entries_.size() - first
+                          << " datagrams dropped";
+                break;
+            }
+
+            // only the first message failed, drop it alone and go on with the rest
+            const Entry& failed = entries_[first];
+            LOG_ERROR << "sendmmsg to " << failed.peerAddr.toString() << " error: " << strerror(savedErrno) << ", "
+                      << segments_[0] << " datagrams dropped";
+            next = first + segments_[0];
+            continue;
+        }
+
+        // a short count means message 'ret' failed, resume from there, the
+        // next call reports its error
+        next = first;
+        for (int i = 0; i < ret; ++i)
+        {
+            next += segments_[static_cast<size_t>(i)];
+        }
+        sent += static_cast<int>(next - first);
+    }
+
+    buffer_.clear();
+    entries_.clear();
+    return sent;
+}
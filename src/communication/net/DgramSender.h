@@ -0,0 +1,102 @@
+/******************************************************************************
+ * File name     : DgramSender.h
+ * Description   :
+ * Version       : v1.0
+ * Create Time   : 2026/10/17
+ * Author        : andy
+ * Modify history:
+ *******************************************************************************
+ * Modify Time   Modify person  Modification
+ * ------------------------------------------------------------------------------
+ *
+ *******************************************************************************/
+
+#ifndef _DGRAMSENDER_H
+#define _DGRAMSENDER_H
+
+#include "InetAddress.h"
+#include "noncopyable.h"
+
+#include <vector>
+
+#include <sys/socket.h>
+
+namespace toyBasket
+{
+
+///
+/// Batched datagram send with sendmmsg(2).
+///
+/// Datagrams are copied into one contiguous buffer by append() and go out
+/// on flush(). When GSO is on, a run of same-size datagrams to the same
+/// peer is handed to the kernel as a single UDP_SEGMENT message; if the
+/// kernel refuses, GSO is switched off and the batch is resent without it.
+class DgramSender : noncopyable
+{
+public:
+    static const int kMaxMessages    = 256;  // mmsghdr per sendmmsg call
+    static const int kMaxSegments    = 64;   // UDP_MAX_SEGMENTS
+    static const int kMaxSegmentSize = 1472; // fits an ethernet MTU
+    static const size_t kMaxGsoBytes = 65000;
+    static const size_t kHighWater   = 1024 * 1024; // callers should flush beyond this
+
+    DgramSender();
+
+    void setGso(bool on)
+    {
+        gso_ = on;
+    }
+
+    bool gso() const
+    {
+        return gso_;
+    }
+
+    /// Queues a copy of @c data for @c peerAddr.
+    void append(const InetAddress& peerAddr, const void* data, int len);
+
+    size_t pending() const
+    {
+        return entries_.size();
+    }
+
+    size_t pendingBytes() const
+    {
+        return buffer_.size();
+    }
+
+    bool full() const
+    {
+        return buffer_.size() >= kHighWater;
+    }
+
+    /// Sends all queued datagrams on @c fd, whatever the kernel refuses
+    /// is logged and dropped, as with sendto(2). A full socket buffer
+    /// (EAGAIN) stops the flush, the rest of the queue is dropped.
+    ///
+    /// @return number of datagrams sent
+    int flush(int fd);
+
+private:
+    struct Entry
+    {
+        InetAddress peerAddr;
+        size_t offset;
+        int len;
+    };
+
+    // number of entries from @c first that can go out as one GSO message
+    size_t gsoRun(size_t first) const;
+
+    bool gso_;
+    std::vector<char> buffer_;
+    std::vector<Entry> entries_;
+    std::vector<struct mmsghdr> msgs_;
+    std::vector<struct iovec> iovecs_;
+    std::vector<char> control_;
+    std::vector<size_t> segments_;
+};
+
+} // namespace toyBasket
+
+#endif // _DGRAMSENDER_H
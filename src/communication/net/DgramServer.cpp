@@ -14,6 +14,8 @@
 #include "DgramServer.h"
 #include "Types.h"
 
+#include <cerrno>
+
 using namespace toyBasket;
 
 DgramServer::DgramServer(EventLoop* loop, const InetAddress& listenAddr, const std::string& nameArg)
@@ -24,6 +26,8 @@ DgramServer::DgramServer(EventLoop* loop, const InetAddress& listenAddr, const s
     , ipPort_(listenAddr.toString())
     , name_(nameArg)
     , started_(0)
+    , flushPending_(false)
+    , alive_(std::make_shared<bool>(true))
 {
     socket_.bindAddress(serverAddr_);
     channel_.setReadCallback(std::bind(&DgramServer::handleRead, this));
@@ -31,6 +35,7 @@ DgramServer::DgramServer(EventLoop* loop, const InetAddress& listenAddr, const s
 
 DgramServer::~DgramServer()
 {
+    flush();
     this->stop();
 }
 
@@ -61,21 +66,63 @@ void DgramServer::send(const InetAddress& clientAddr, const void* message, int l
     }
 }
 
-void DgramServer::handleRead()
+void DgramServer::queueSend(const InetAddress& clientAddr, const void* message, int len)
 {
-    char message[MSG_BUF_SIZE];
-    struct sockaddr_un peerAddr = {};
-    socklen_t addrLen           = sizeof(peerAddr);
-    memset(&peerAddr, 0, addrLen);
-    ssize_t nr = ::recvfrom(socket_.fd(), message, sizeof(message), 0, reinterpret_cast<struct sockaddr*>(&peerAddr),
-                            &addrLen);
+    loop_->assertInLoopThread();
+    sender_.append(clientAddr, message, len);
+    if (sender_.full())
+    {
+        flush();
+    }
+    else if (!flushPending_)
+    {
+        flushPending_ = true;
+        std::weak_ptr<bool> alive(alive_);
+        loop_->queueInLoop([this, alive] {
+            if (alive.lock())
+            {
+                flush();
+            }
+        });
+    }
+}
 
-    if (nr > 0)
+void DgramServer::flush()
+{
+    loop_->assertInLoopThread();
+    flushPending_ = false;
+    if (sender_.pending() > 0)
     {
-        messageCallback_(InetAddress(peerAddr), message, static_cast<int>(nr));
+        sender_.flush(socket_.fd());
     }
-    else
+}
+
+void DgramServer::handleRead()
+{
+    for (int round = 0; round < DgramReceiver::kMaxBatchesPerRead; ++round)
     {
-        LOG_ERROR << "recv error: " << strerror(errno);
+        int n = receiver_.receive(socket_.fd());
+        if (n < 0)
+        {
+            if (errno != EAGAIN && errno != EWOULDBLOCK)
+            {
+                LOG_ERROR << "recv error: " << strerror(errno);
+            }
+            break;
+        }
+
+        if (batchCallback_)
+        {
+            batchCallback_(receiver_.datagrams(), n);
+        }
+        else if (messageCallback_)
+        {
+            DgramReceiver::forEach(receiver_.datagrams(), n, messageCallback_);
+        }
+
+        if (n < receiver_.batchSize())
+        {
+            break;
+        }
     }
 }
@@ -20,8 +20,11 @@
 #include "Socket.h"
 #include "Channel.h"
 #include "Callbacks.h"
+#include "DgramReceiver.h"
+#include "DgramSender.h"
 
 #include <atomic>
+#include <memory>
 
 namespace toyBasket
 {
@@ -55,15 +58,39 @@ public:
 
     void stop();
 
-    /// Set message callback.
+    /// Set message callback, called once per datagram.
     /// Not thread safe.
     void setMessageCallback(const DgramEventCallback& cb)
     {
         messageCallback_ = cb;
     }
 
+    /// Set batch callback, called once per recvmmsg with all datagrams
+    /// received. Takes precedence over the message callback.
+    /// Not thread safe.
+    void setBatchCallback(const DgramBatchCallback& cb)
+    {
+        batchCallback_ = cb;
+    }
+
     void send(const InetAddress& clientAddr, const void* message, int len);
 
+    /// Queues a datagram. Everything queued during one loop iteration goes
+    /// out together with sendmmsg after the events are handled.
+    /// Must be called in the loop thread.
+    void queueSend(const InetAddress& clientAddr, const void* message, int len);
+
+    /// Sends the queued datagrams now.
+    /// Must be called in the loop thread.
+    void flush();
+
+    /// Sends runs of same-size datagrams to one client as a single
+    /// UDP_SEGMENT (GSO) message, falls back silently if unsupported.
+    void setGso(bool on)
+    {
+        sender_.setGso(on);
+    }
+
 private:
     void handleRead();
 
@@ -76,6 +103,11 @@ private:
     const std::string name_;
     std::atomic<int> started_;
     DgramEventCallback messageCallback_;
+    DgramBatchCallback batchCallback_;
+    DgramReceiver receiver_;
+    DgramSender sender_;
+    bool flushPending_;
+    std::shared_ptr<bool> alive_; // checked by the queued flush
 };
 
 } // namespace toyBasket
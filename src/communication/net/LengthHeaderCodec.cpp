@@ -0,0 +1,168 @@
+/******************************************************************************
+ * File name     : LengthHeaderCodec.cpp
+ * Description   :
+ * Version       : v1.0
+ * Create Time   : 2026/10/17
+ * Author        : andy
+ * Modify history:
+ *******************************************************************************
+ * Modify Time   Modify person  Modification
+ * ------------------------------------------------------------------------------
+ *
+ *******************************************************************************/
+
+#include "LengthHeaderCodec.h"
+#include "Types.h"
+
+#include <algorithm>
+#include <arpa/inet.h>
+#include <cassert>
+
+using namespace toyBasket;
+
+const size_t LengthHeaderCodec::kDefaultMaxFrameSize;
+const size_t LengthHeaderCodec::kMaxVarint32Size;
+
+LengthHeaderCodec::LengthHeaderCodec(const FrameCallback& cb, HeaderType type, size_t maxFrameSize)
+    : frameCallback_(cb)
+    , type_(type)
+    , maxFrameSize_(type == kFixed16 ? std::min<size_t>(maxFrameSize, 0xffff) : maxFrameSize)
+{
+}
+
+void LengthHeaderCodec::onMessage(const StreamConnectionPtr& conn, Buffer* buf)
+{
+    while (buf->readableBytes() > 0 && parseFrame(conn, buf))
+    {
+    }
+}
+
+bool LengthHeaderCodec::parseFrame(const StreamConnectionPtr& conn, Buffer* buf)
+{
+    size_t len = 0;
+    int header = parseHeader(buf, &len);
+    if (header == 0)
+    {
+        return false;
+    }
+    if (header < 0 || len > maxFrameSize_)
+    {
+        LOG_ERROR << "LengthHeaderCodec: invalid frame length " << len << " from " << conn->name();
+        buf->retrieveAll();
+        conn->forceClose();
+        return false;
+    }
+
+    const size_t total = static_cast<size_t>(header) + len;
+    if (buf->readableBytes() < total)
+    {
+        return false;
+    }
+    frameCallback_(conn, StringPiece(buf->peek() + header, static_cast<int>(len)));
+    buf->retrieve(total);
+    return true;
+}
+
+int LengthHeaderCodec::parseHeader(const Buffer* buf, size_t* len) const
+{
+    switch (type_)
+    {
+    case kFixed16:
+        if (buf->readableBytes() < sizeof(uint16_t))
+        {
+            return 0;
+        }
+        *len = static_cast<uint16_t>(buf->peekInt16());
+        return static_cast<int>(sizeof(uint16_t));
+    case kFixed32:
+        if (buf->readableBytes() < sizeof(uint32_t))
+        {
+            return 0;
+        }
+        *len = static_cast<uint32_t>(buf->peekInt32());
+        return static_cast<int>(sizeof(uint32_t));
+    case kVarint32:
+    {
+        uint32_t value = 0;
+        int n          = decodeVarint32(buf->peek(), buf->readableBytes(), &value);
+        *len           = value;
+        return n;
+    }
+    default:
+        return -1;
+    }
+}
+
+size_t LengthHeaderCodec::headerSize(size_t len) const
+{
+    switch (type_)
+    {
+    case kFixed16:
+        return sizeof(uint16_t);
+    case kFixed32:
+        return sizeof(uint32_t);
+    default:
+    {
+        char scratch[kMaxVarint32Size];
+        return encodeVarint32(static_cast<uint32_t>(len), scratch);
+    }
+    }
+}
+
+void LengthHeaderCodec::appendHeader(std::string* out, size_t len) const
+{
+    assert(len <= maxFrameSize_);
+    switch (type_)
+    {
+    case kFixed16:
+    {
+        uint16_t be16 = htons(static_cast<uint16_t>(len));
+        out->append(reinterpret_cast<const char*>(&be16), sizeof be16);
+        break;
+    }
+    case kFixed32:
+    {
+        uint32_t be32 = htonl(static_cast<uint32_t>(len));
+        out->append(reinterpret_cast<const char*>(&be32), sizeof be32);
+        break;
+    }
+    default:
+    {
+        char varint[kMaxVarint32Size];
+        out->append(varint, encodeVarint32(static_cast<uint32_t>(len), varint));
+        break;
+    }
+    }
+}
+
+size_t LengthHeaderCodec::encodeVarint32(uint32_t value, char* out)
+{
+    size_t n = 0;
+    while (value >= 0x80)
+    {
+        out[n++] = static_cast<char>((value & 0x7f) | 0x80);
+        value >>= 7;
+    }
+    out[n++] = static_cast<char>(value);
+    return n;
+}
+
+int LengthHeaderCodec::decodeVarint32(const char* data, size_t len, uint32_t* value)
+{
+    uint32_t result = 0;
+    for (size_t i = 0; i < kMaxVarint32Size; ++i)
+    {
+        if (i >= len)
+        {
+            return 0;
+        }
+        uint32_t byte = static_cast<unsigned char>(data[i]);
+        result |= (byte & 0x7f) << (7 * i);
+        if ((byte & 0x80) == 0)
+        {
+            *value = result;
+            return static_cast<int>(i + 1);
+        }
+    }
+    return -1;
+}
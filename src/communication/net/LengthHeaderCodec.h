@@ -0,0 +1,104 @@
+/******************************************************************************
+ * File name     : LengthHeaderCodec.h
+ * Description   :
+ * Version       : v1.0
+ * Create Time   : 2026/10/17
+ * Author        : andy
+ * Modify history:
+ *******************************************************************************
+ * Modify Time   Modify person  Modification
+ * ------------------------------------------------------------------------------
+ *
+ *******************************************************************************/
+
+#ifndef _LENGTHHEADERCODEC_H
+#define _LENGTHHEADERCODEC_H
+
+#include "Buffer.h"
+#include "StreamConnection.h"
+#include "StringPiece.h"
+#include "noncopyable.h"
+
+#include <functional>
+#include <string>
+
+namespace toyBasket
+{
+
+///
+/// Splits a byte stream into length-prefixed frames.
+///
+/// @code
+/// +--------------------+---------------------------+
+/// | length (header)    | frame, 'length' bytes     |
+/// +--------------------+---------------------------+
+/// @endcode
+///
+/// Complete frames are delivered as views into the connection's input
+/// Buffer, nothing is copied. A view is only valid inside the callback.
+/// A frame longer than maxFrameSize, or a malformed header, closes the
+/// connection.
+class LengthHeaderCodec : noncopyable
+{
+public:
+    enum HeaderType
+    {
+        kFixed16,  // 2 bytes, network byte order
+        kFixed32,  // 4 bytes, network byte order
+        kVarint32, // base 128 varint, 1 to 5 bytes
+    };
+
+    typedef std::function<void(const StreamConnectionPtr&, const StringPiece& frame)> FrameCallback;
+
+    static const size_t kDefaultMaxFrameSize = 64 * 1024 * 1024;
+    static const size_t kMaxVarint32Size     = 5;
+
+    explicit LengthHeaderCodec(const FrameCallback& cb, HeaderType type = kFixed32,
+                               size_t maxFrameSize = kDefaultMaxFrameSize);
+
+    /// Bind this as the connection's message callback.
+    void onMessage(const StreamConnectionPtr& conn, Buffer* buf);
+
+    /// Delivers the first frame in @c buf if it is complete, for callers
+    /// that mix other framings into the same stream.
+    /// @return false if more bytes are needed or the connection was closed
+    bool parseFrame(const StreamConnectionPtr& conn, Buffer* buf);
+
+    HeaderType headerType() const
+    {
+        return type_;
+    }
+
+    size_t maxFrameSize() const
+    {
+        return maxFrameSize_;
+    }
+
+    /// Bytes of header needed for a frame of @c len bytes.
+    size_t headerSize(size_t len) const;
+
+    /// Appends the header for a frame of @c len bytes, the caller appends
+    /// the frame itself right after.
+    void appendHeader(std::string* out, size_t len) const;
+
+    /// Writes @c value as a varint to @c out, which has room for
+    /// kMaxVarint32Size bytes.
+    /// @return bytes written
+    static size_t encodeVarint32(uint32_t value, char* out);
+
+    /// Reads a varint from at most @c len bytes.
+    /// @return bytes consumed, 0 if more bytes are needed, -1 if malformed
+    static int decodeVarint32(const char* data, size_t len, uint32_t* value);
+
+private:
+    // @return header bytes, 0 if incomplete, -1 if malformed
+    int parseHeader(const Buffer* buf, size_t* len) const;
+
+    FrameCallback frameCallback_;
+    const HeaderType type_;
+    const size_t maxFrameSize_;
+};
+
+} // namespace toyBasket
+
+#endif // _LENGTHHEADERCODEC_H
@@ -0,0 +1,242 @@
+/******************************************************************************
+ * File name     : Lz4Codec.cpp
+ * Description   :
+ * Version       : v1.0
+ * Create Time   : 2026/10/17
+ * Author        : andy
+ * Modify history:
+ *******************************************************************************
+ * Modify Time   Modify person  Modification
+ * ------------------------------------------------------------------------------
+ *
+ *******************************************************************************/
+
+#include "Lz4Codec.h"
+
+#include <cassert>
+#include <cstring>
+
+using namespace toyBasket;
+
+const size_t Lz4Codec::kMaxInputSize;
+
+namespace
+{
+
+// limits from the block format spec
+const size_t kMinMatch     = 4;
+const size_t kLastLiterals = 5;  // the last 5 bytes are always literals
+const size_t kMfLimit      = 12; // the last match starts at least 12 bytes before the end
+const size_t kMaxDistance  = 65535;
+const int kRunMask         = 15;
+
+inline uint32_t read32(const char* p)
+{
+    uint32_t v;
+    memcpy(&v, p, sizeof v);
+    return v;
+}
+
+inline uint64_t read64(const char* p)
+{
+    uint64_t v;
+    memcpy(&v, p, sizeof v);
+    return v;
+}
+
+// bytes equal at the front of p and ref, stops at limit
+inline size_t matchLength(const char* p, const char* ref, const char* limit)
+{
+    const char* start = p;
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    while (p + sizeof(uint64_t) <= limit)
+    {
+        uint64_t diff = read64(p) ^ read64(ref);
+        if (diff)
+        {
+            return static_cast<size_t>(p - start) + static_cast<size_t>(__builtin_ctzll(diff) >> 3);
+        }
+        p += sizeof(uint64_t);
+        ref += sizeof(uint64_t);
+    }
+#endif
+    while (p < limit && *p == *ref)
+    {
+        ++p;
+        ++ref;
+    }
+    return static_cast<size_t>(p - start);
+}
+
+inline char* writeLength(char* op, size_t len)
+{
+    while (len >= 255)
+    {
+        *op++ = static_cast<char>(255);
+        len -= 255;
+    }
+    *op++ = static_cast<char>(len);
+    return op;
+}
+
+inline bool readLength(const unsigned char** ip, const unsigned char* iend, size_t* len)
+{
+    unsigned char byte = 0;
+    do
+    {
+        if (*ip >= iend)
+        {
+            return false;
+        }
+        byte = *(*ip)++;
+        *len += byte;
+    } while (byte == 255);
+    return true;
+}
+
+// token, optional extra literal length bytes, then the literals
+inline char* writeLiterals(char* op, const char* literals, size_t len, int matchToken)
+{
+    if (len >= static_cast<size_t>(kRunMask))
+    {
+        *op++ = static_cast<char>((kRunMask << 4) | matchToken);
+        op    = writeLength(op, len - kRunMask);
+    }
+    else
+    {
+        *op++ = static_cast<char>((static_cast<int>(len) << 4) | matchToken);
+    }
+    memcpy(op, literals, len);
+    return op + len;
+}
+
+} // namespace
+
+Lz4Codec::Lz4Codec()
+{
+    memset(table_, 0, sizeof table_);
+}
+
+size_t Lz4Codec::compress(const char* data, size_t len, char* out)
+{
+    assert(len <= kMaxInputSize);
+    const char* ip     = data;
+    const char* anchor = data;
+    const char* iend   = data + len;
+    char* op           = out;
+
+    if (len > kMfLimit)
+    {
+        const char* mflimit    = iend - kMfLimit;
+        const char* matchlimit = iend - kLastLiterals;
+        size_t misses          = 0;
+        while (ip < mflimit)
+        {
+            // stale entries from an earlier block are harmless, every
+            // candidate is checked against the bytes before it is used
+            const uint32_t seq  = read32(ip);
+            const uint32_t h    = (seq * 2654435761U) >> (32 - kHashLog);
+            const size_t pos    = static_cast<size_t>(ip - data);
+            const size_t refPos = table_[h];
+            table_[h]           = static_cast<uint32_t>(pos);
+            if (refPos >= pos || pos - refPos > kMaxDistance || read32(data + refPos) != seq)
+            {
+                // skip faster through data that does not compress
+                ip += 1 + (misses++ >> 6);
+                continue;
+            }
+            misses = 0;
+
+            const char* ref = data + refPos;
+            while (ip > anchor && ref > data && ip[-1] == ref[-1])
+            {
+                --ip;
+                --ref;
+            }
+            const size_t extra  = matchLength(ip + kMinMatch, ref + kMinMatch, matchlimit);
+            const size_t offset = static_cast<size_t>(ip - ref);
+
+            const int matchToken = extra >= static_cast<size_t>(kRunMask) ? kRunMask : static_cast<int>(extra);
+            op                   = writeLiterals(op, anchor, static_cast<size_t>(ip - anchor), matchToken);
+            *op++                = static_cast<char>(offset & 0xff);
+            *op++                = static_cast<char>(offset >> 8);
+            if (extra >= static_cast<size_t>(kRunMask))
+            {
+                op = writeLength(op, extra - kRunMask);
+            }
+
+            ip += kMinMatch + extra;
+            anchor = ip;
+        }
+    }
+
+    op = writeLiterals(op, anchor, static_cast<size_t>(iend - anchor), 0);
+    return static_cast<size_t>(op - out);
+}
+
+int Lz4Codec::decompress(const char* data, size_t len, char* out, size_t cap)
+{
+    const unsigned char* ip   = reinterpret_cast<const unsigned char*>(data);
+    const unsigned char* iend = ip + len;
+    char* op                  = out;
+    char* oend                = out + cap;
+
+    while (ip < iend)
+    {
+        const unsigned token = *ip++;
+        size_t literals      = token >> 4;
+        if (literals == static_cast<size_t>(kRunMask) && !readLength(&ip, iend, &literals))
+        {
+            return -1;
+        }
+        if (literals > static_cast<size_t>(iend - ip) || literals > static_cast<size_t>(oend - op))
+        {
+            return -1;
+        }
+        memcpy(op, ip, literals);
+        ip += literals;
+        op += literals;
+        // the last sequence has literals only
+        if (ip == iend)
+        {
+            return static_cast<int>(op - out);
+        }
+
+        if (iend - ip < 2)
+        {
+            return -1;
+        }
+        const size_t offset = static_cast<size_t>(ip[0]) | (static_cast<size_t>(ip[1]) << 8);
+        ip += 2;
+        if (offset == 0 || offset > static_cast<size_t>(op - out))
+        {
+            return -1;
+        }
+        size_t match = token & kRunMask;
+        if (match == static_cast<size_t>(kRunMask) && !readLength(&ip, iend, &match))
+        {
+            return -1;
+        }
+        match += kMinMatch;
+        if (match > static_cast<size_t>(oend - op))
+        {
+            return -1;
+        }
+
+        const char* ref = op - offset;
+        if (offset >= match)
+        {
+            memcpy(op, ref, match);
+            op += match;
+        }
+        else
+        {
+            // overlapping copy repeats the last 'offset' bytes
+            for (size_t i = 0; i < match; ++i)
+            {
+                *op++ = *ref++;
+            }
+        }
+    }
+    return -1;
+}
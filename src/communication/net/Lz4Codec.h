@@ -0,0 +1,68 @@
+/******************************************************************************
+ * File name     : Lz4Codec.h
+ * Description   :
+ * Version       : v1.0
+ * Create Time   : 2026/10/17
+ * Author        : andy
+ * Modify history:
+ *******************************************************************************
+ * Modify Time   Modify person  Modification
+ * ------------------------------------------------------------------------------
+ *
+ *******************************************************************************/
+
+#ifndef _LZ4CODEC_H
+#define _LZ4CODEC_H
+
+#include "noncopyable.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace toyBasket
+{
+
+///
+/// Compressor for the LZ4 block format, no frame header and no checksum.
+///
+/// Blocks are interchangeable with LZ4_compress_default() and
+/// LZ4_decompress_safe(). The match table survives between calls, so keep
+/// one instance per thread instead of one per message.
+class Lz4Codec : noncopyable
+{
+public:
+    static const size_t kMaxInputSize = 0x7E000000; // LZ4_MAX_INPUT_SIZE
+
+    Lz4Codec();
+
+    /// Worst case compressed size of @c len bytes.
+    static size_t compressBound(size_t len)
+    {
+        return len + len / 255 + 16;
+    }
+
+    /// Compresses @c len bytes, at most kMaxInputSize, into @c out which
+    /// has room for compressBound(len) bytes.
+    /// @return compressed bytes
+    size_t compress(const char* data, size_t len, char* out);
+
+    /// Most bytes @c len compressed bytes can decompress to, a peer that
+    /// claims more is lying.
+    static size_t decompressBound(size_t len)
+    {
+        return len * 255 + 16;
+    }
+
+    /// @return decompressed bytes, -1 if the block is malformed or does not
+    /// fit in @c cap bytes
+    static int decompress(const char* data, size_t len, char* out, size_t cap);
+
+private:
+    static const int kHashLog = 12;
+
+    uint32_t table_[1 << kHashLog]; // offsets of recent 4-byte sequences
+};
+
+} // namespace toyBasket
+
+#endif // _LZ4CODEC_H
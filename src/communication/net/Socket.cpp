@@ -581,6 +581,23 @@ void Socket::setKeepAlive(bool on)
     // FIXME CHECK
 }
 
+void Socket::setBusyPoll(int usec)
+{
+#ifdef SO_BUSY_POLL
+    int ret = ::setsockopt(sockfd_, SOL_SOCKET, SO_BUSY_POLL, &usec, static_cast<socklen_t>(sizeof usec));
+    if (ret < 0)
+    {
+        // more than net.core.busy_read needs CAP_NET_ADMIN
+        LOG_ERROR << "SO_BUSY_POLL failed: " << strerror(errno);
+    }
+#else
+    if (usec > 0)
+    {
+        LOG_ERROR << "SO_BUSY_POLL is not supported.";
+    }
+#endif
+}
+
 void Socket::setMulticastIF(const std::string& address)
 {
     struct in_addr addr = {};
@@ -122,6 +122,12 @@ public:
     ///
     void setKeepAlive(bool on);
 
+    ///
+    /// set SO_BUSY_POLL, microseconds a read of an empty socket may poll
+    /// the device queue before it returns
+    ///
+    void setBusyPoll(int usec);
+
     ///
     /// set IP_MULTICAST_IF
     ///
@@ -15,7 +15,6 @@
 
 #include "Connector.h"
 #include "EventLoop.h"
-#include "Timer.h"
 
 #include <cstdio> // snprintf
 
@@ -87,7 +86,7 @@ StreamClient::~StreamClient()
     {
         connector_->stop();
         // FIXME: HACK
-        TimerManager::getInstance()->addTimer(1000, std::bind(&detail::removeConnector, connector_));
+        loop_->runAfter(1, std::bind(&detail::removeConnector, connector_));
     }
 }
 
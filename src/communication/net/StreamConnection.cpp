@@ -16,13 +16,23 @@
 #include "Channel.h"
 #include "EventLoop.h"
 #include "Socket.h"
-#include "Timer.h"
 #include "WeakCallback.h"
 
 #include <cerrno>
 
 using namespace toyBasket;
 
+namespace
+{
+// batched messages up to this size are copied into shared blocks, cheaper than
+// one allocation each; larger ones are queued as they are
+const size_t kMaxBatchCopy = 4096;
+// how often a connection stopped by its BufferAccount looks again
+const double kAccountRetrySeconds = 0.01;
+// bytes an edge-triggered connection reads per turn when no budget is set
+const size_t kEdgeReadBudget = 1024 * 1024;
+} // namespace
+
 void toyBasket::defaultConnectionCallback(const StreamConnectionPtr& conn)
 {
     LOG_INFO << conn->localAddress().toString() << " -> " << conn->peerAddress().toString() << " is "
@@ -47,6 +57,15 @@ StreamConnection::StreamConnection(EventLoop* loop, const std::string& nameArg,
     , localAddr_(localAddr)
     , peerAddr_(peerAddr)
     , highWaterMark_(64 * 1024 * 1024)
+    , inputBuffer_(0)
+    , batchPending_(false)
+    , readBudget_(0)
+    , bufferIdleTimeout_(0)
+    , activity_(0)
+    , idleActivity_(0)
+    , idleTimerArmed_(false)
+    , accountedBytes_(0)
+    , accountPaused_(false)
 {
     channel_->setReadCallback(std::bind(&StreamConnection::handleRead, this));
     channel_->setWriteCallback(std::bind(&StreamConnection::handleWrite, this));
@@ -89,6 +108,11 @@ void StreamConnection::send(const void* data, int len)
     send(StringPiece(static_cast<const char*>(data), len));
 }
 
+void StreamConnection::send(const char* message)
+{
+    send(StringPiece(message));
+}
+
 void StreamConnection::send(const StringPiece& message)
 {
     if (state_ == kConnected)
@@ -99,16 +123,64 @@ void StreamConnection::send(const StringPiece& message)
         }
         else
         {
-            void (StreamConnection::*fp)(const StringPiece& message) = &StreamConnection::sendInLoop;
-            loop_->runInLoop(std::bind(fp,
-                                       this, // FIXME
-                                       message.as_string()));
-            // std::forward<string>(message)));
+            // one copy here, the loop thread queues the block itself
+            send(BufferChain::Block(new std::string(message.data(), static_cast<size_t>(message.size()))));
         }
     }
 }
 
-// FIXME efficiency!!!
+void StreamConnection::send(std::string&& message)
+{
+    if (state_ == kConnected)
+    {
+        send(BufferChain::Block(new std::string(std::move(message))));
+    }
+}
+
+void StreamConnection::send(const BufferChain::Block& message)
+{
+    if (state_ == kConnected)
+    {
+        if (loop_->isInLoopThread())
+        {
+            sendInLoop(message);
+        }
+        else
+        {
+            void (StreamConnection::*fp)(const BufferChain::Block& message) = &StreamConnection::sendInLoop;
+            loop_->runInLoop(std::bind(fp, shared_from_this(), message));
+        }
+    }
+}
+
+void StreamConnection::sendBatched(std::string&& message)
+{
+    if (state_ != kConnected)
+    {
+        return;
+    }
+
+    bool schedule = false;
+    {
+        std::lock_guard<std::mutex> lock(batchMutex_);
+        if (message.size() <= kMaxBatchCopy)
+        {
+            batch_.append(message.data(), message.size());
+        }
+        else
+        {
+            batch_.append(BufferChain::Block(new std::string(std::move(message))));
+        }
+        schedule      = !batchPending_;
+        batchPending_ = true;
+    }
+    // pending functors run after this iteration's events
+    if (schedule)
+    {
+        loop_->queueInLoop(std::bind(&StreamConnection::flushBatchInLoop, shared_from_this()));
+    }
+}
+
 void StreamConnection::send(Buffer* buf)
 {
     if (state_ == kConnected)
@@ -120,11 +192,7 @@ void StreamConnection::send(Buffer* buf)
         }
         else
         {
-            void (StreamConnection::*fp)(const StringPiece& message) = &StreamConnection::sendInLoop;
-            loop_->runInLoop(std::bind(fp,
-                                       this, // FIXME
-                                       buf->retrieveAllAsString()));
-            // std::forward<string>(message)));
+            send(buf->retrieveAllAsString());
         }
     }
 }
@@ -135,6 +203,16 @@ void StreamConnection::sendInLoop(const StringPiece& message)
 }
 
 void StreamConnection::sendInLoop(const void* data, size_t len)
+{
+    sendInLoop(data, len, BufferChain::Block());
+}
+
+void StreamConnection::sendInLoop(const BufferChain::Block& message)
+{
+    sendInLoop(message->data(), message->size(), message);
+}
+
+void StreamConnection::sendInLoop(const void* data, size_t len, const BufferChain::Block& block)
 {
     loop_->assertInLoopThread();
     ssize_t nwrote   = 0;
@@ -145,6 +223,11 @@ void StreamConnection::sendInLoop(const void* data, size_t len)
         LOG_WARNING << "disconnected, give up writing";
         return;
     }
+    // batched messages queued before this one go first
+    if (batchPending_)
+    {
+        flushBatchInLoop();
+    }
     // if no thing in output queue, try writing directly
     if (!channel_->isWriting() && outputBuffer_.readableBytes() == 0)
     {
@@ -179,12 +262,70 @@ void StreamConnection::sendInLoop(const void* data, size_t len)
         {
             loop_->queueInLoop(std::bind(highWaterMarkCallback_, shared_from_this(), oldLen + remaining));
         }
-        outputBuffer_.append(static_cast<const char*>(data) + nwrote, remaining);
+        if (block)
+        {
+            outputBuffer_.append(block, static_cast<size_t>(nwrote));
+        }
+        else
+        {
+            outputBuffer_.append(static_cast<const char*>(data) + nwrote, remaining);
+        }
         if (!channel_->isWriting())
         {
             channel_->enableWriting();
         }
     }
+    afterIo();
+}
+
+void StreamConnection::flushBatchInLoop()
+{
+    loop_->assertInLoopThread();
+    BufferChain batch;
+    {
+        std::lock_guard<std::mutex> lock(batchMutex_);
+        batch.append(std::move(batch_));
+        batchPending_ = false;
+    }
+    if (batch.empty() || state_ == kDisconnected)
+    {
+        return;
+    }
+
+    size_t oldLen = outputBuffer_.readableBytes();
+    size_t newLen = oldLen + batch.readableBytes();
+    if (newLen >= highWaterMark_ && oldLen < highWaterMark_ && highWaterMarkCallback_)
+    {
+        loop_->queueInLoop(std::bind(highWaterMarkCallback_, shared_from_this(), newLen));
+    }
+    outputBuffer_.append(std::move(batch));
+    if (channel_->isWriting())
+    {
+        // handleWrite() takes it from here
+        return;
+    }
+
+    int savedErrno = 0;
+    ssize_t n      = outputBuffer_.writeFd(channel_->fd(), &savedErrno);
+    if (n < 0 && savedErrno != EWOULDBLOCK)
+    {
+        LOG_ERROR << "StreamConnection::flushBatchInLoop: " << strerror(savedErrno);
+        if (savedErrno == EPIPE || savedErrno == ECONNRESET)
+        {
+            outputBuffer_.retrieveAll();
+            afterIo();
+            return;
+        }
+    }
+    if (outputBuffer_.readableBytes() > 0)
+    {
+        channel_->enableWriting();
+    }
+    else if (writeCompleteCallback_)
+    {
+        loop_->queueInLoop(std::bind(writeCompleteCallback_, shared_from_this()));
+    }
+    afterIo();
 }
 
 void StreamConnection::shutdown()
@@ -201,6 +342,10 @@ void StreamConnection::shutdown()
 void StreamConnection::shutdownInLoop()
 {
     loop_->assertInLoopThread();
+    if (batchPending_)
+    {
+        flushBatchInLoop();
+    }
     if (!channel_->isWriting())
     {
         // we are not writing
@@ -223,11 +368,10 @@ void StreamConnection::forceCloseWithDelay(double seconds)
     if (state_ == kConnected || state_ == kDisconnecting)
     {
         setState(kDisconnecting);
-        TimerManager::getInstance()->addTimer(
-            static_cast<unsigned int>(seconds * 1000),
-            makeWeakCallback(shared_from_this(),
-                             &StreamConnection::forceClose)); // not forceCloseInLoop to avoid
-                                                              // race condition
+        loop_->runAfter(seconds,
+                        makeWeakCallback(shared_from_this(),
+                                         &StreamConnection::forceClose)); // not forceCloseInLoop to avoid
+                                                                          // race condition
     }
 }
 
@@ -266,6 +410,11 @@ void StreamConnection::setTcpNoDelay(bool on)
     }
 }
 
+void StreamConnection::setEdgeTriggered(bool on)
+{
+    channel_->setEdgeTriggered(on);
+}
+
 void StreamConnection::startRead()
 {
     loop_->runInLoop(std::bind(&StreamConnection::startReadInLoop, this));
@@ -301,6 +450,10 @@ void StreamConnection::connectEstablished()
     loop_->assertInLoopThread();
     assert(state_ == kConnecting);
     setState(kConnected);
+    if (loop_->socketBusyPoll() > 0)
+    {
+        socket_->setBusyPoll(loop_->socketBusyPoll());
+    }
     channel_->tie(shared_from_this());
     channel_->enableReading();
 
@@ -317,27 +470,81 @@ void StreamConnection::connectDestroyed()
 
         connectionCallback_(shared_from_this());
     }
+    if (account_)
+    {
+        updateAccount();
+    }
     channel_->remove();
 }
 
 void StreamConnection::handleRead()
 {
     loop_->assertInLoopThread();
-    int savedErrno = 0;
-    ssize_t n      = inputBuffer_.readFd(channel_->fd(), &savedErrno);
-    if (n > 0)
+    if (account_ && account_->overLimit() && inputBuffer_.readableBytes() == 0)
     {
-        messageCallback_(shared_from_this(), &inputBuffer_);
+        // leave the data in the socket until the group drains
+        channel_->disableReading();
+        accountPaused_ = true;
+        loop_->runAfter(kAccountRetrySeconds,
+                        makeWeakCallback(shared_from_this(), &StreamConnection::resumeReadIfUnderLimit));
+        return;
     }
-    else if (n == 0)
+
+    const bool edge     = channel_->isEdgeTriggered();
+    const size_t budget = readBudget_ > 0 ? readBudget_ : (edge ? kEdgeReadBudget : 0);
+    size_t total        = 0;
+    for (;;)
     {
-        handleClose();
+        int savedErrno = 0;
+        bool full      = false;
+        ssize_t n      = inputBuffer_.readFd(channel_->fd(), &savedErrno, &full);
+        if (n > 0)
+        {
+            total += static_cast<size_t>(n);
+            messageCallback_(shared_from_this(), &inputBuffer_);
+            // a short read emptied the socket, but edge triggered we read on
+            // to see an EOF that came with the data
+            if (budget == 0 || (!full && !edge) || !channel_->isReading())
+            {
+                break;
+            }
+            if (total >= budget || (account_ && account_->overLimit()))
+            {
+                if (edge)
+                {
+                    // no new edge is coming for what is left, pick it up after the others
+                    loop_->queueInLoop(makeWeakCallback(shared_from_this(), &StreamConnection::continueRead));
+                }
+                break;
+            }
+        }
+        else if (n == 0)
+        {
+            handleClose();
+            return;
+        }
+        else
+        {
+            if (savedErrno != EAGAIN && savedErrno != EWOULDBLOCK)
+            {
+                errno = savedErrno;
+                LOG_ERROR << "StreamConnection::handleRead: " << strerror(errno);
+                handleError();
+            }
+            break;
+        }
     }
-    else
+    if (total > 0)
+    {
+        afterIo();
+    }
+}
+
+void StreamConnection::continueRead()
+{
+    if (state_ != kDisconnected && channel_->isReading())
     {
-        errno = savedErrno;
-        LOG_ERROR << "StreamConnection::handleRead: " << strerror(errno);
-        handleError();
+        handleRead();
     }
 }
 
@@ -346,10 +553,17 @@ void StreamConnection::handleWrite()
     loop_->assertInLoopThread();
     if (channel_->isWriting())
     {
-        ssize_t n = ::write(channel_->fd(), outputBuffer_.peek(), outputBuffer_.readableBytes());
+        int savedErrno = 0;
+        ssize_t n      = outputBuffer_.writeFd(channel_->fd(), &savedErrno);
+        if (n > 0 && channel_->isEdgeTriggered())
+        {
+            // the next edge only comes after the socket buffer has been full
+            while (outputBuffer_.readableBytes() > 0 && outputBuffer_.writeFd(channel_->fd(), &savedErrno) > 0)
+            {
+            }
+        }
         if (n > 0)
         {
-            outputBuffer_.retrieve(static_cast<unsigned long long>(n));
             if (outputBuffer_.readableBytes() == 0)
             {
                 channel_->disableWriting();
@@ -362,10 +576,11 @@ void StreamConnection::handleWrite()
                     shutdownInLoop();
                 }
             }
+            afterIo();
         }
         else
         {
-            LOG_ERROR << "StreamConnection::handleWrite: " << strerror(errno);
+            LOG_ERROR << "StreamConnection::handleWrite: " << strerror(savedErrno);
             // if (state_ == kDisconnecting)
             // {
             //   shutdownInLoop();
@@ -386,6 +601,10 @@ void StreamConnection::handleClose()
     // we don't close fd, leave it to dtor, so we can find leaks easily.
     setState(kDisconnected);
     channel_->disableAll();
+    if (account_)
+    {
+        updateAccount();
+    }
 
     StreamConnectionPtr guardThis(shared_from_this());
     connectionCallback_(guardThis);
@@ -393,6 +612,82 @@ void StreamConnection::handleClose()
     closeCallback_(guardThis);
 }
 
+void StreamConnection::afterIo()
+{
+    ++activity_;
+    if (bufferIdleTimeout_ > 0 && !idleTimerArmed_)
+    {
+        armIdleTimer();
+    }
+    if (account_)
+    {
+        updateAccount();
+    }
+}
+
+void StreamConnection::armIdleTimer()
+{
+    idleTimerArmed_ = true;
+    idleActivity_   = activity_;
+    loop_->runAfter(bufferIdleTimeout_, makeWeakCallback(shared_from_this(), &StreamConnection::onIdleTimer));
+}
+
+void StreamConnection::onIdleTimer()
+{
+    loop_->assertInLoopThread();
+    idleTimerArmed_ = false;
+    if (state_ == kDisconnected || bufferIdleTimeout_ <= 0)
+    {
+        return;
+    }
+    if (activity_ != idleActivity_)
+    {
+        // still busy, look again one period later
+        armIdleTimer();
+        return;
+    }
+
+    // the next byte in either direction allocates again
+    if (inputBuffer_.readableBytes() > 0)
+    {
+        inputBuffer_.shrink(0);
+    }
+    outputBuffer_.shrink();
+    std::lock_guard<std::mutex> lock(batchMutex_);
+    batch_.shrink();
+}
+
+void StreamConnection::updateAccount()
+{
+    const size_t bytes =
+        state_ == kDisconnected ? 0 : inputBuffer_.readableBytes() + outputBuffer_.readableBytes();
+    if (bytes != accountedBytes_)
+    {
+        account_->add(static_cast<int64_t>(bytes) - static_cast<int64_t>(accountedBytes_));
+        accountedBytes_ = bytes;
+    }
+}
+
+void StreamConnection::resumeReadIfUnderLimit()
+{
+    loop_->assertInLoopThread();
+    if (!accountPaused_ || state_ == kDisconnected)
+    {
+        return;
+    }
+    if (account_->overLimit())
+    {
+        loop_->runAfter(kAccountRetrySeconds,
+                        makeWeakCallback(shared_from_this(), &StreamConnection::resumeReadIfUnderLimit));
+        return;
+    }
+    accountPaused_ = false;
+    if (reading_)
+    {
+        channel_->enableReading();
+    }
+}
+
 void StreamConnection::handleError()
 {
     int err          = 0;
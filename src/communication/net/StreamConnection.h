@@ -15,12 +15,16 @@
 #define _STREAMCONNECTION_H
 
 #include "Buffer.h"
+#include "BufferAccount.h"
+#include "BufferChain.h"
 #include "Callbacks.h"
 #include "InetAddress.h"
 #include "Types.h"
 #include "noncopyable.h"
 
+#include <atomic>
 #include <memory>
+#include <mutex>
 
 // struct tcp_info is in <netinet/tcp.h>
 struct tcp_info;
@@ -74,9 +78,17 @@ public:
     bool getTcpInfo(struct tcp_info*) const;
     std::string getTcpInfoString() const;
 
-    // void send(string&& message); // C++11
     void send(const void* data, int len);
+    void send(const char* message);
     void send(const StringPiece& message);
+    // takes ownership of message, nothing is copied
+    void send(std::string&& message);
+    // shares message, the same block may be queued on many connections
+    void send(const BufferChain::Block& message);
+    // queued with the other batched messages and written with one writev(2)
+    // at the end of the current loop iteration, thread safe. Only the first
+    // message of a batch wakes up the loop. A later send() goes out after it.
+    void sendBatched(std::string&& message);
     // void send(Buffer&& message); // C++11
     void send(Buffer* buf); // this one will swap data
     void shutdown();        // NOT thread safe, no simultaneous calling
@@ -114,13 +126,48 @@ public:
         highWaterMark_         = highWaterMark;
     }
 
+    /// The input buffer only holds storage while it has data (see Buffer).
+    /// With a timeout, a connection that has had no traffic for that many
+    /// seconds also trims a partly received message to fit and frees its
+    /// output queues; it happens one to two periods after the last byte.
+    /// 0 (the default) turns the timeout off. Not thread safe, call before
+    /// connectEstablished() or in loop.
+    void setBufferIdleTimeout(double seconds)
+    {
+        bufferIdleTimeout_ = seconds;
+    }
+
+    /// Keeps @c account up to date with the bytes in our buffers. While it is
+    /// over its limit we stop reading, unless we are in the middle of a
+    /// message and have to read the rest to get rid of it.
+    /// Must be called before connectEstablished().
+    void setBufferAccount(const std::shared_ptr<BufferAccount>& account)
+    {
+        account_ = account;
+    }
+
+    /// Keeps reading after a readiness event until the socket is empty or
+    /// @c bytes have been read, then lets the other channels of the loop
+    /// have their turn. 0 (the default) reads once per event.
+    /// Not thread safe, call before connectEstablished() or in loop.
+    void setReadBudget(size_t bytes)
+    {
+        readBudget_ = bytes;
+    }
+
+    /// Registers the socket edge-triggered, see Channel::setEdgeTriggered().
+    /// Reads then always drain the socket, in steps of the read budget
+    /// (1 MiB if none is set), and writes go on until the socket is full.
+    /// Not thread safe, call before connectEstablished() or in loop.
+    void setEdgeTriggered(bool on);
+
     /// Advanced interface
     Buffer* inputBuffer()
     {
         return &inputBuffer_;
     }
 
-    Buffer* outputBuffer()
+    BufferChain* outputBuffer()
     {
         return &outputBuffer_;
     }
@@ -145,12 +192,16 @@ private:
         kDisconnecting
     };
     void handleRead();
+    void continueRead();
     void handleWrite();
     void handleClose();
     void handleError();
-    // void sendInLoop(string&& message);
     void sendInLoop(const StringPiece& message);
     void sendInLoop(const void* data, size_t len);
+    void sendInLoop(const BufferChain::Block& message);
+    // block is queued instead of copying the unwritten part when it is set
+    void sendInLoop(const void* data, size_t len, const BufferChain::Block& block);
+    void flushBatchInLoop();
     void shutdownInLoop();
     // void shutdownAndForceCloseInLoop(double seconds);
     void forceCloseInLoop();
@@ -161,6 +212,12 @@ private:
     const char* stateToString() const;
     void startReadInLoop();
     void stopReadInLoop();
+    // bookkeeping after bytes moved in or out, in loop
+    void afterIo();
+    void armIdleTimer();
+    void onIdleTimer();
+    void updateAccount();
+    void resumeReadIfUnderLimit();
 
     EventLoop* loop_;
     const std::string name_;
@@ -178,9 +235,21 @@ private:
     CloseCallback closeCallback_;
     size_t highWaterMark_;
     Buffer inputBuffer_;
-    Buffer outputBuffer_; // FIXME: use list<Buffer> as output buffer.
-                          // FIXME: creationTime_, lastReceiveTime_
-                          //        bytesReceived_, bytesSent_
+    BufferChain outputBuffer_;
+    // sendBatched() data not yet moved to outputBuffer_
+    std::mutex batchMutex_;
+    BufferChain batch_;
+    std::atomic<bool> batchPending_;
+    size_t readBudget_;
+    double bufferIdleTimeout_;
+    uint64_t activity_;     // bumped by afterIo()
+    uint64_t idleActivity_; // activity_ when the idle timer was armed
+    bool idleTimerArmed_;
+    std::shared_ptr<BufferAccount> account_;
+    size_t accountedBytes_; // our part of account_
+    bool accountPaused_;    // reading stopped until account_ drains
+    // FIXME: creationTime_, lastReceiveTime_
+    //        bytesReceived_, bytesSent_
 };
 
 typedef std::shared_ptr<StreamConnection> StreamConnectionPtr;
@@ -15,18 +15,28 @@
 
 #include "Acceptor.h"
 #include "EventLoop.h"
+#include "TaskEventLoopThreadPool.h"
 
 #include <cstdio> // snprintf
+#include <future>
 
 using namespace toyBasket;
 
 StreamServer::StreamServer(EventLoop* loop, const InetAddress& listenAddr, const std::string& nameArg, Option option)
     : loop_(CHECK_NOTNULL(loop))
+    , listenAddr_(listenAddr)
     , ipPort_(listenAddr.toString())
     , name_(nameArg)
-    , acceptor_(new Acceptor(loop, listenAddr, option == kReusePort))
+    , option_(option)
+    , acceptor_(new Acceptor(loop, listenAddr, option != kNoReusePort))
     , connectionCallback_(defaultConnectionCallback)
     , messageCallback_(defaultMessageCallback)
+    , threadPool_(new TaskEventLoopThreadPool(loop, name_))
+    , balance_(kRoundRobin)
+    , readBudget_(0)
+    , edgeTriggered_(false)
+    , bufferIdleTimeout_(0)
+    , bufferAccount_(std::make_shared<BufferAccount>())
     , started_(0)
     , nextConnId_(1)
 {
@@ -38,6 +48,21 @@ StreamServer::~StreamServer()
     loop_->assertInLoopThread();
     LOG_INFO << "StreamServer::~StreamServer [" << name_ << "] destructing";
 
+    // an Acceptor must be torn down in its own loop, and its callback holds
+    // this, so wait until every shard has stopped accepting
+    for (auto& item : shardAcceptors_)
+    {
+        Acceptor* acceptor = item.release();
+        std::promise<void> done;
+        acceptor->ownerLoop()->runInLoop([acceptor, &done]() {
+            delete acceptor;
+            done.set_value();
+        });
+        done.get_future().wait();
+    }
+    shardAcceptors_.clear();
+
+    std::lock_guard<std::mutex> lock(mutex_);
     for (auto& item : connections_)
     {
         StreamConnectionPtr conn(item.second);
@@ -46,22 +71,70 @@ StreamServer::~StreamServer()
     }
 }
 
+void StreamServer::setThreadNum(int numThreads)
+{
+    assert(0 <= numThreads);
+    threadPool_->setThreadNum(numThreads);
+}
+
 void StreamServer::start()
 {
     if (started_.exchange(1) == 0)
     {
-        assert(!acceptor_->listenning());
-        loop_->runInLoop(std::bind(&Acceptor::listen, get_pointer(acceptor_)));
+        threadPool_->start(threadInitCallback_);
+
+        if (option_ == kReusePortSharded && listenAddr_.family() != AF_UNIX)
+        {
+            loop_->runInLoop(std::bind(&StreamServer::startShards, this));
+        }
+        else
+        {
+            assert(!acceptor_->listenning());
+            loop_->runInLoop(std::bind(&Acceptor::listen, get_pointer(acceptor_)));
+        }
     }
 }
 
+void StreamServer::startShards()
+{
+    loop_->assertInLoopThread();
+    std::vector<EventLoop*> loops = threadPool_->getAllLoops();
+    if (loops.size() == 1 && loops[0] == loop_)
+    {
+        // no I/O threads, the base acceptor is the only shard
+        acceptor_->listen();
+        return;
+    }
+
+    // acceptor_ keeps the port bound but never listens, so no SYN lands on loop_.
+    // With port 0 the shards join the port the kernel gave acceptor_
+    const InetAddress shardAddr = listenAddr_.portNetEndian() == 0 ? acceptor_->localAddress() : listenAddr_;
+    for (EventLoop* ioLoop : loops)
+    {
+        Acceptor* acceptor = new Acceptor(ioLoop, shardAddr, true);
+        acceptor->setNewConnectionCallback(std::bind(&StreamServer::newConnectionInLoop, this, ioLoop, _1, _2));
+        shardAcceptors_.push_back(std::unique_ptr<Acceptor>(acceptor));
+        ioLoop->runInLoop(std::bind(&Acceptor::listen, acceptor));
+    }
+    LOG_INFO << "StreamServer::startShards [" << name_ << "] - " << loops.size() << " accept shards on " << ipPort_;
+}
+
 void StreamServer::newConnection(int sockfd, const InetAddress& peerAddr)
 {
     loop_->assertInLoopThread();
+    newConnectionInLoop(pickIoLoop(), sockfd, peerAddr);
+}
+
+void StreamServer::newConnectionInLoop(EventLoop* ioLoop, int sockfd, const InetAddress& peerAddr)
+{
     char buf[64];
-    snprintf(buf, sizeof buf, "-%s#%d", ipPort_.c_str(), nextConnId_);
-    ++nextConnId_;
-    std::string connName = name_ + buf;
+    std::string connName;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        snprintf(buf, sizeof buf, "-%s#%d", ipPort_.c_str(), nextConnId_);
+        ++nextConnId_;
+        connName = name_ + buf;
+    }
 
     LOG_INFO << "StreamServer::newConnection [" << name_ << "] - new connection [" << connName << "] from "
              << peerAddr.toString();
@@ -77,13 +150,51 @@ void StreamServer::newConnection(int sockfd, const InetAddress& peerAddr)
     InetAddress localAddr(localaddr);
     // FIXME poll with zero timeout to double confirm the new connection
     // FIXME use make_shared if necessary
-    StreamConnectionPtr conn(new StreamConnection(loop_, connName, sockfd, localAddr, peerAddr));
-    connections_[connName] = conn;
+    StreamConnectionPtr conn(new StreamConnection(ioLoop, connName, sockfd, localAddr, peerAddr));
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        connections_[connName] = conn;
+        ++loopConnections_[ioLoop];
+    }
     conn->setConnectionCallback(connectionCallback_);
     conn->setMessageCallback(messageCallback_);
     conn->setWriteCompleteCallback(writeCompleteCallback_);
     conn->setCloseCallback(std::bind(&StreamServer::removeConnection, this, _1)); // FIXME: unsafe
-    loop_->runInLoop(std::bind(&StreamConnection::connectEstablished, conn));
+    conn->setReadBudget(readBudget_);
+    conn->setEdgeTriggered(edgeTriggered_);
+    conn->setBufferIdleTimeout(bufferIdleTimeout_);
+    conn->setBufferAccount(bufferAccount_);
+    ioLoop->runInLoop(std::bind(&StreamConnection::connectEstablished, conn));
+}
+
+EventLoop* StreamServer::pickIoLoop()
+{
+    loop_->assertInLoopThread();
+    switch (balance_)
+    {
+    case kLeastConnections:
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::vector<EventLoop*> loops = threadPool_->getAllLoops();
+        EventLoop* ioLoop             = loops[0];
+        size_t least                  = loopConnections_[ioLoop];
+        for (size_t i = 1; i < loops.size() && least > 0; ++i)
+        {
+            size_t count = loopConnections_[loops[i]];
+            if (count < least)
+            {
+                ioLoop = loops[i];
+                least  = count;
+            }
+        }
+        return ioLoop;
+    }
+    case kLeastQueued:
+        return threadPool_->getLeastQueuedLoop();
+    case kRoundRobin:
+    default:
+        return threadPool_->getNextLoop();
+    }
 }
 
 void StreamServer::removeConnection(const StreamConnectionPtr& conn)
@@ -96,9 +207,17 @@ void StreamServer::removeConnectionInLoop(const StreamConnectionPtr& conn)
 {
     loop_->assertInLoopThread();
     LOG_INFO << "StreamServer::removeConnectionInLoop [" << name_ << "] - connection " << conn->name();
-    size_t n = connections_.erase(conn->name());
-    (void)n;
-    assert(n == 1);
     EventLoop* ioLoop = conn->getLoop();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        size_t n = connections_.erase(conn->name());
+        (void)n;
+        assert(n == 1);
+        LoopLoadMap::iterator it = loopConnections_.find(ioLoop);
+        if (it != loopConnections_.end() && it->second > 0)
+        {
+            --it->second;
+        }
+    }
     ioLoop->queueInLoop(std::bind(&StreamConnection::connectDestroyed, conn));
 }
@@ -18,12 +18,15 @@
 
 #include <map>
 #include <atomic>
+#include <mutex>
+#include <vector>
 
 namespace toyBasket
 {
 
 class Acceptor;
 class EventLoop;
+class TaskEventLoopThreadPool;
 
 ///
 /// STREAM server, supports single-threaded and thread-pool models.
@@ -37,6 +40,14 @@ public:
     {
         kNoReusePort,
         kReusePort,
+        kReusePortSharded, // one SO_REUSEPORT listening socket per I/O loop
+    };
+    /// How an accepted connection picks its I/O loop.
+    enum LoadBalance
+    {
+        kRoundRobin,
+        kLeastConnections,
+        kLeastQueued, // fewest pending functors, see EventLoop::queueSize()
     };
 
     // StreamServer(EventLoop* loop, const InetAddress& listenAddr);
@@ -57,10 +68,75 @@ public:
         return loop_;
     }
 
+    /// Set the number of threads for handling input.
+    ///
+    /// Always accepts new connection in loop's thread.
+    /// Must be called before @c start
+    /// @param numThreads
+    /// - 0 means all I/O in loop's thread, no thread will created.
+    ///   this is the default value.
+    /// - 1 means all I/O in another thread.
+    /// - N means a thread pool with N threads, new connections
+    ///   are assigned according to the LoadBalance policy.
+    void setThreadNum(int numThreads);
+    void setThreadInitCallback(const ThreadInitCallback& cb)
+    {
+        threadInitCallback_ = cb;
+    }
+    /// Must be called before @c start
+    void setLoadBalance(LoadBalance balance)
+    {
+        balance_ = balance;
+    }
+
+    /// Read budget and trigger mode of accepted connections, see
+    /// StreamConnection::setReadBudget() and setEdgeTriggered().
+    /// Apply to connections accepted after the call.
+    void setReadBudget(size_t bytes)
+    {
+        readBudget_ = bytes;
+    }
+    void setEdgeTriggered(bool on)
+    {
+        edgeTriggered_ = on;
+    }
+
+    /// Frees the buffers of connections idle for @c seconds, see
+    /// StreamConnection::setBufferIdleTimeout(). 0 (the default) keeps them.
+    /// Applies to connections accepted after the call.
+    void setBufferIdleTimeout(double seconds)
+    {
+        bufferIdleTimeout_ = seconds;
+    }
+    /// Caps the bytes buffered by all connections together, connections
+    /// stop reading while the total is over it. 0 (the default) means no cap.
+    /// Thread safe.
+    void setBufferedBytesLimit(size_t bytes)
+    {
+        bufferAccount_->setLimit(bytes);
+    }
+    /// Bytes in the input and output buffers of all connections.
+    /// Thread safe.
+    size_t bufferedBytes() const
+    {
+        return bufferAccount_->bytes();
+    }
+
+    /// valid after calling start()
+    std::shared_ptr<TaskEventLoopThreadPool> threadPool()
+    {
+        return threadPool_;
+    }
+
     /// Starts the server if it's not listenning.
     ///
     /// It's harmless to call it multiple times.
     /// Thread safe.
+    ///
+    /// With kReusePortSharded and at least one I/O thread, every I/O loop
+    /// gets its own Acceptor, the kernel spreads incoming SYNs over them
+    /// and a connection stays in the loop that accepted it. The
+    /// LoadBalance policy is not used in that mode.
     void start();
 
     /// Set connection callback.
@@ -87,24 +163,43 @@ public:
 private:
     /// Not thread safe, but in loop
     void newConnection(int sockfd, const InetAddress& peerAddr);
+    /// Thread safe, called in the loop that accepted sockfd
+    void newConnectionInLoop(EventLoop* ioLoop, int sockfd, const InetAddress& peerAddr);
+    /// Not thread safe, but in loop
+    void startShards();
     /// Thread safe.
     void removeConnection(const StreamConnectionPtr& conn);
     /// Not thread safe, but in loop
     void removeConnectionInLoop(const StreamConnectionPtr& conn);
+    /// Not thread safe, but in loop
+    EventLoop* pickIoLoop();
 
     typedef std::map<std::string, StreamConnectionPtr> ConnectionMap;
+    typedef std::map<EventLoop*, size_t> LoopLoadMap;
 
     EventLoop* loop_; // the acceptor loop
+    const InetAddress listenAddr_;
     const std::string ipPort_;
     const std::string name_;
+    const Option option_;
     std::unique_ptr<Acceptor> acceptor_; // avoid revealing Acceptor
+    std::vector<std::unique_ptr<Acceptor>> shardAcceptors_; // one per I/O loop, kReusePortSharded only
     ConnectionCallback connectionCallback_;
     MessageCallback messageCallback_;
     WriteCompleteCallback writeCompleteCallback_;
+    ThreadInitCallback threadInitCallback_;
+    std::shared_ptr<TaskEventLoopThreadPool> threadPool_;
+    LoadBalance balance_;
+    size_t readBudget_;
+    bool edgeTriggered_;
+    double bufferIdleTimeout_;
+    std::shared_ptr<BufferAccount> bufferAccount_;
     std::atomic<int> started_;
-    // always in loop thread
+    // shard acceptors run newConnectionInLoop in their own threads
+    std::mutex mutex_;
     int nextConnId_;
     ConnectionMap connections_;
+    LoopLoadMap loopConnections_; // live connections per I/O loop
 };
 
 } // namespace toyBasket
@@ -16,6 +16,8 @@
 
 #include "UdpMultiCastListener.h"
 
+#include <cerrno>
+
 using namespace toyBasket;
 
 UdpMultiCastListener::UdpMultiCastListener(EventLoop* loop, const InetAddress& groupAddr, const InetAddress& localAddr,
@@ -51,19 +53,30 @@ void UdpMultiCastListener::stop()
 
 void UdpMultiCastListener::handleRead()
 {
-    std::string buf;
-    InetAddress peerAddr;
-    ssize_t n = socket_.recvfrom(buf, peerAddr);
-    if (n > 0)
-    {
-        messageCallback_(peerAddr, buf.data(), static_cast<int>(buf.size()));
-    }
-    else if (n == 0)
+    for (int round = 0; round < DgramReceiver::kMaxBatchesPerRead; ++round)
     {
-        LOG_WARNING << name_ << "udp server close the connect \n";
-    }
-    else
-    {
-        LOG_ERROR << name_ << "recv errno: " << strerror(errno);
+        int n = receiver_.receive(socket_.fd());
+        if (n < 0)
+        {
+            if (errno != EAGAIN && errno != EWOULDBLOCK)
+            {
+                LOG_ERROR << name_ << "recv errno: " << strerror(errno);
+            }
+            break;
+        }
+
+        if (batchCallback_)
+        {
+            batchCallback_(receiver_.datagrams(), n);
+        }
+        else if (messageCallback_)
+        {
+            DgramReceiver::forEach(receiver_.datagrams(), n, messageCallback_);
+        }
+
+        if (n < receiver_.batchSize())
+        {
+            break;
+        }
     }
 }
@@ -13,9 +13,9 @@
 #ifndef _GUDPMULTICASTLISTENER_H
 #define _GUDPMULTICASTLISTENER_H
 
-#include "Buffer.h"
 #include "Callbacks.h"
 #include "Channel.h"
+#include "DgramReceiver.h"
 #include "EventLoop.h"
 #include "InetAddress.h"
 #include "Socket.h"
@@ -44,13 +44,21 @@ public:
         return name_;
     }
 
-    /// Set message callback.
+    /// Set message callback, called once per datagram.
     /// Not thread safe.
     void setMessageCallback(DgramEventCallback cb)
     {
         messageCallback_ = std::move(cb);
     }
 
+    /// Set batch callback, called once per recvmmsg with all datagrams
+    /// received. Takes precedence over the message callback.
+    /// Not thread safe.
+    void setBatchCallback(DgramBatchCallback cb)
+    {
+        batchCallback_ = std::move(cb);
+    }
+
 private:
     void handleRead();
     void stop();
@@ -63,7 +71,8 @@ private:
     Socket socket_;
     Channel channel_;
     DgramEventCallback messageCallback_;
-    Buffer inputBuffer_;
+    DgramBatchCallback batchCallback_;
+    DgramReceiver receiver_;
 };
 
 } // namespace toyBasket
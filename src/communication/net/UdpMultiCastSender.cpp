@@ -12,17 +12,36 @@
  *******************************************************************************/
 
 #include "UdpMultiCastSender.h"
+#include "EventLoop.h"
 #include "Types.h"
 
 using namespace toyBasket;
 
 UdpMultiCastSender::UdpMultiCastSender(const InetAddress& GroupAddr, const std::string& nameArg)
-    : socket_(::socket(GroupAddr.family(), SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0))
+    : loop_(NULL)
+    , socket_(::socket(GroupAddr.family(), SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0))
     , groupAddr_(GroupAddr)
     , name_(nameArg)
+    , flushPending_(false)
+    , alive_(std::make_shared<bool>(true))
 {
 }
 
+UdpMultiCastSender::UdpMultiCastSender(EventLoop* loop, const InetAddress& GroupAddr, const std::string& nameArg)
+    : loop_(CHECK_NOTNULL(loop))
+    , socket_(::socket(GroupAddr.family(), SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0))
+    , groupAddr_(GroupAddr)
+    , name_(nameArg)
+    , flushPending_(false)
+    , alive_(std::make_shared<bool>(true))
+{
+}
+
+UdpMultiCastSender::~UdpMultiCastSender()
+{
+    flush();
+}
+
 void UdpMultiCastSender::setMulticastIF(const std::string& address)
 {
     socket_.setMulticastIF(address);
@@ -47,3 +66,33 @@ void UdpMultiCastSender::send(const void* message, int len)
         LOG_ERROR << name_ << " UDP MultiCastSener sendto error: " << strerror(errno);
     }
 }
+
+void UdpMultiCastSender::queueSend(const void* message, int len)
+{
+    sender_.append(groupAddr_, message, len);
+    if (sender_.full())
+    {
+        flush();
+    }
+    else if (loop_ && !flushPending_)
+    {
+        loop_->assertInLoopThread();
+        flushPending_ = true;
+        std::weak_ptr<bool> alive(alive_);
+        loop_->queueInLoop([this, alive] {
+            if (alive.lock())
+            {
+                flush();
+            }
+        });
+    }
+}
+
+void UdpMultiCastSender::flush()
+{
+    flushPending_ = false;
+    if (sender_.pending() > 0)
+    {
+        sender_.flush(socket_.fd());
+    }
+}
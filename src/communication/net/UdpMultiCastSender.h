@@ -14,18 +14,26 @@
 #ifndef _UDPMULTICASTSENDER_H
 #define _UDPMULTICASTSENDER_H
 
+#include "DgramSender.h"
 #include "InetAddress.h"
 #include "Socket.h"
 #include "noncopyable.h"
 
+#include <memory>
+
 namespace toyBasket
 {
 
+class EventLoop;
+
 class UdpMultiCastSender : noncopyable
 {
 public:
     UdpMultiCastSender(const InetAddress& GroupAddr, const std::string& nameArg);
-    ~UdpMultiCastSender() = default;
+    /// With a loop, datagrams queued by queueSend() are flushed once per
+    /// loop iteration, and queueSend() must be called in the loop thread.
+    UdpMultiCastSender(EventLoop* loop, const InetAddress& GroupAddr, const std::string& nameArg);
+    ~UdpMultiCastSender();
 
     const std::string& name() const
     {
@@ -38,10 +46,28 @@ public:
 
     void send(const void* message, int len);
 
+    /// Queues a datagram for the group, it is sent by the next flush().
+    /// Not thread safe.
+    void queueSend(const void* message, int len);
+
+    /// Sends all queued datagrams with sendmmsg.
+    void flush();
+
+    /// Sends runs of same-size datagrams as a single UDP_SEGMENT (GSO)
+    /// message, falls back silently if unsupported.
+    void setGso(bool on)
+    {
+        sender_.setGso(on);
+    }
+
 private:
+    EventLoop* loop_; // may be NULL, then flush() is up to the user
     Socket socket_;
     InetAddress groupAddr_;
     const std::string name_;
+    DgramSender sender_;
+    bool flushPending_;
+    std::shared_ptr<bool> alive_; // checked by the queued flush
 };
 
 } // namespace toyBasket
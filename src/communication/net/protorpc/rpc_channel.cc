@@ -1,117 +1,581 @@
 #include "rpc_channel.h"
+#include "EventLoop.h"
+#include "rpc_codec.h"
+#include "rpc_controller.h"
 #include "rpc_meta.pb.h"
-#include <arpa/inet.h>
+#include "rpc_stream.h"
+#include <algorithm>
+#include <limits>
 
 namespace toyBasket
 {
 
+const int64_t RpcChannel::kDefaultTimeoutMs;
+const int RpcChannel::kMaxConsecutiveFailures;
+const int RpcChannel::kInitEjectMs;
+const int RpcChannel::kMaxEjectMs;
+
 RpcChannel::RpcChannel(EventLoop* loop, const InetAddress& serverAddr)
-    : client_(new StreamClient(loop, serverAddr, "rpc_channel"))
+    : RpcChannel(loop, std::vector<InetAddress>(1, serverAddr))
+{
+}
+
+RpcChannel::RpcChannel(EventLoop* loop, const std::vector<InetAddress>& endpoints, int connections_per_endpoint,
+                       LoadBalance policy)
+    : loop_(loop)
+    , codec_(std::bind(&RpcChannel::onFrame, this, _1, _2), std::bind(&RpcChannel::onHeaderFrame, this, _1, _2, _3))
+    , policy_(policy)
+    , connections_(endpoints.size() * static_cast<size_t>(std::max(connections_per_endpoint, 1)))
     , index_(0)
+    , next_(0)
+    , rand_(std::random_device()())
+    , default_timeout_ms_(kDefaultTimeoutMs)
+    , fixed_header_(true)
+    , write_coalescing_(true)
+    , compress_threshold_(0)
+    , alive_(std::make_shared<bool>(true))
 {
-    client_->setMessageCallback(std::bind(&RpcChannel::onMessage, this, _1, _2));
-    client_->setConnectionCallback(std::bind(&RpcChannel::onConnection, this, _1));
+    for (const InetAddress& addr : endpoints)
+    {
+        Endpoint endpoint = { addr, 0, kInitEjectMs, TimePoint() };
+        endpoints_.push_back(endpoint);
+    }
+    for (size_t i = 0; i < connections_.size(); ++i)
+    {
+        // 同一节点的连接交错排列, 轮转时相邻两次落在不同节点上
+        Connection& connection  = connections_[i];
+        connection.endpoint_    = i % endpoints_.size();
+        connection.outstanding_  = 0;
+        connection.fixed_header_ = false;
+        connection.compression_  = false;
+        connection.client_.reset(new StreamClient(loop, endpoints_[connection.endpoint_].addr_, "rpc_channel"));
+        // 析构时连接由 StreamClient 在 loop 线程上关闭, 那时的断开回调和迟到的数据都不能再碰 this
+        std::weak_ptr<bool> alive(alive_);
+        connection.client_->setMessageCallback([this, alive](const StreamConnectionPtr& conn, Buffer* buf) {
+            if (alive.lock())
+            {
+                codec_.onMessage(conn, buf);
+            }
+        });
+        connection.client_->setConnectionCallback([this, alive, i](const StreamConnectionPtr& conn) {
+            if (alive.lock())
+            {
+                onConnection(i, conn);
+            }
+        });
+        // 断开后自动重连, 连不上时按 Connector 的退避间隔重试
+        connection.client_->enableRetry();
+    }
 }
 
 RpcChannel::~RpcChannel()
 {
+    // 已经排队的回调看到 alive_ 失效后不再访问 this, 未到期的定时器在这里撤掉
+    alive_.reset();
+    std::map<int64_t, OutstandingCall> out;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        out.swap(out_);
+    }
+    // 未完成的调用不会再有结果, 在这里结束, 调用方不必一直等下去
+    for (auto& it : out)
+    {
+        if (it.second.timer.valid())
+        {
+            loop_->cancel(it.second.timer);
+        }
+        failCall(it.second, "channel destroyed");
+    }
 }
 
 void RpcChannel::connect()
 {
-    client_->connect();
+    for (auto& connection : connections_)
+    {
+        connection.client_->connect();
+    }
 }
 
 void RpcChannel::CallMethod(const ::google::protobuf::MethodDescriptor* method,
                             ::google::protobuf::RpcController* controller, const ::google::protobuf::Message* request,
                             ::google::protobuf::Message* response, ::google::protobuf::Closure* done)
 {
-    std::string request_data_str;
-    request->SerializeToString(&request_data_str);
-    // 发送格式: meta_size + meta_data + request_data
-    RpcMeta rpc_meta;
-    ++index_;
-    rpc_meta.set_id(index_);
-    rpc_meta.set_server(method->service()->name());
-    rpc_meta.set_method(method->name());
-    rpc_meta.set_data_size(request_data_str.size());
-
-    std::string rpc_meta_str;
-    rpc_meta.SerializeToString(&rpc_meta_str);
-    int32_t meta_size = htonl(rpc_meta_str.size());
+    RpcController* rpc_controller = dynamic_cast<RpcController*>(controller);
+    int64_t timeout_ms            = default_timeout_ms_;
+    if (rpc_controller && rpc_controller->Timeout() > 0)
+    {
+        timeout_ms = rpc_controller->Timeout();
+    }
+    const bool batched = write_coalescing_ && !(rpc_controller && rpc_controller->ImmediateSend());
+
+    // 先登记再发送, 多个线程可以同时发起调用
+    int64_t id                = 0;
+    uint32_t method_id        = 0;
+    bool fixed_header         = false;
+    size_t compress_threshold = 0;
+    OutstandingCall out       = { response, done, controller, TimerId(), 0, method, std::shared_ptr<RpcStream>() };
+    if (method->client_streaming() || method->server_streaming())
+    {
+        // 流式调用的回调都在 RpcController 上, 收到的消息按 response 的类型解析
+        if (!rpc_controller || !response)
+        {
+            failCall(out, "streaming call needs toyBasket::RpcController and response");
+            return;
+        }
+        out.stream = rpc_controller->GetStream();
+        timeout_ms = rpc_controller->Timeout();
+    }
+    StreamConnectionPtr conn;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        int picked = pickConnection();
+        if (picked >= 0)
+        {
+            out.connection = static_cast<size_t>(picked);
+            conn           = connections_[out.connection].conn_.lock();
+        }
+        if (conn)
+        {
+            Connection& connection = connections_[out.connection];
+            std::map<const ::google::protobuf::MethodDescriptor*, uint32_t>::iterator it =
+                connection.method_ids_.find(method);
+            if (it != connection.method_ids_.end())
+            {
+                method_id = it->second;
+                // 流式帧只用 RpcMeta, 开始的请求也一样
+                fixed_header = connection.fixed_header_ && !out.stream;
+            }
+            if (connection.compression_)
+            {
+                std::map<const ::google::protobuf::MethodDescriptor*, size_t>::const_iterator threshold =
+                    method_compress_threshold_.find(method);
+                compress_threshold =
+                    threshold != method_compress_threshold_.end() ? threshold->second : compress_threshold_;
+            }
+            ++connection.outstanding_;
+            id       = ++index_;
+            out_[id] = out;
+        }
+    }
+
+    if (!conn)
+    {
+        failCall(out, "not connected");
+        return;
+    }
+    if (out.stream)
+    {
+        // 在请求发出和取消回调登记之前绑定, 服务端的第一条消息到达时已经能找到
+        out.stream->Attach(conn, id, &codec_.length_codec(), *response, compress_threshold, batched);
+    }
+    // StartCancel 可以在任意线程调用, 转到 loop 线程上与响应和超时排队; 钩子只带走 alive_ 的 weak_ptr
+    std::weak_ptr<bool> alive(alive_);
+    EventLoop* loop = loop_;
+    if (rpc_controller && !rpc_controller->SetCancelHook([this, alive, loop, id] {
+            loop->runInLoop([this, alive, id] {
+                if (alive.lock())
+                {
+                    onCancel(id);
+                }
+            });
+        }))
+    {
+        if (takeCall(id, &out))
+        {
+            failCall(out, "canceled");
+        }
+        return;
+    }
+
+    if (timeout_ms > 0)
+    {
+        TimerId timer = loop_->runAfter(static_cast<double>(timeout_ms) / 1000, [this, alive, id] {
+            if (alive.lock())
+            {
+                onTimeout(id);
+            }
+        });
+        bool stored = false;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            std::map<int64_t, OutstandingCall>::iterator it = out_.find(id);
+            if (it != out_.end())
+            {
+                it->second.timer = timer;
+                stored           = true;
+            }
+        }
+        // 取消或断开可能在登记定时器之前已经结束了调用, 取出调用的一方撤不到这个定时器, 由这里撤掉
+        if (!stored)
+        {
+            loop_->cancel(timer);
+        }
+    }
+
+    const uint32_t timeout =
+        static_cast<uint32_t>(std::min<int64_t>(timeout_ms, std::numeric_limits<uint32_t>::max()));
     std::string serialzied_str;
-    serialzied_str.append(reinterpret_cast<const char*>(&meta_size), sizeof(int32_t));
-    serialzied_str += rpc_meta_str;
-    serialzied_str += request_data_str;
+    if (fixed_header)
+    {
+        RpcHeader header = { kRpcFlagAcceptCompressed, static_cast<uint64_t>(id), method_id, 0, timeout };
+        if (timeout > 0)
+        {
+            header.flags |= kRpcFlagDeadline;
+        }
+        SerializeRpcHeaderFrame(&header, *request, &serialzied_str, compress_threshold);
+        SendRpcFrame(conn, std::move(serialzied_str), batched);
+        return;
+    }
+
+    RpcMeta rpc_meta;
+    rpc_meta.set_id(id);
+    if (method_id)
+    {
+        rpc_meta.set_method_id(method_id);
+    }
+    else
+    {
+        rpc_meta.set_server(method->service()->name());
+        rpc_meta.set_method(method->name());
+    }
+    rpc_meta.set_timeout_ms(timeout);
+    // 解压总是支持的, 压缩与否由各自的阈值决定
+    rpc_meta.set_features(fixed_header_ ? kRpcFeatureFixedHeader | kRpcFeatureCompression : kRpcFeatureCompression);
+
+    // 发送格式: frame_size + meta_size + meta_data + request_data
+    SerializeRpcFrame(codec_.length_codec(), &rpc_meta, *request, &serialzied_str, compress_threshold);
+    SendRpcFrame(conn, std::move(serialzied_str), batched);
+}
+
+void RpcChannel::onFrame(const StreamConnectionPtr& conn, const StringPiece& frame)
+{
+    RpcMeta meta_proto;
+    StringPiece payload;
+    if (!ParseRpcFrame(frame, &meta_proto, &payload))
+    {
+        LOG_ERROR << "RpcChannel: bad frame from " << conn->name();
+        return;
+    }
+    if (meta_proto.stream() != 0)
+    {
+        onStreamFrame(meta_proto, payload);
+        return;
+    }
 
-    OutstandingCall out = { response, done };
+    onResponse(static_cast<int64_t>(meta_proto.id()), meta_proto.method_id(), meta_proto.features(),
+               meta_proto.failed() ? &meta_proto.error_text() : NULL, payload, meta_proto.compressed());
+}
+
+void RpcChannel::onHeaderFrame(const StreamConnectionPtr& conn, const RpcHeader& header, const StringPiece& payload)
+{
+    if (header.flags & kRpcFlagFailed)
+    {
+        std::string error_text(payload.data(), static_cast<size_t>(payload.size()));
+        onResponse(static_cast<int64_t>(header.id), 0, 0, &error_text, StringPiece(), false);
+    }
+    else
+    {
+        onResponse(static_cast<int64_t>(header.id), 0, 0, NULL, payload, (header.flags & kRpcFlagCompressed) != 0);
+    }
+}
+
+void RpcChannel::onResponse(int64_t id, uint32_t method_id, uint32_t features, const std::string* error_text,
+                            const StringPiece& payload, bool compressed)
+{
+    // 已经超时或取消的调用, 迟到的响应直接丢弃
+    OutstandingCall out;
+    if (!takeCall(id, &out))
+    {
+        return;
+    }
     {
         std::unique_lock<std::mutex> lock(mutex_);
-        out_[index_] = out;
+        Connection& connection = connections_[out.connection];
+        Endpoint& endpoint     = endpoints_[connection.endpoint_];
+        endpoint.failures_     = 0;
+        endpoint.eject_ms_     = kInitEjectMs;
+        if (method_id)
+        {
+            connection.method_ids_[out.method] = method_id;
+        }
+        if (features & kRpcFeatureFixedHeader)
+        {
+            connection.fixed_header_ = true;
+        }
+        if (features & kRpcFeatureCompression)
+        {
+            connection.compression_ = true;
+        }
     }
 
-    StreamConnectionPtr conn = conn_.lock();
-    if (conn)
+    if (error_text)
+    {
+        failCall(out, *error_text);
+        return;
+    }
+    if (out.response && !ParseRpcPayload(payload, compressed, out.response))
     {
-        conn->send(serialzied_str);
+        failCall(out, "bad response");
+        return;
+    }
+    if (out.stream)
+    {
+        out.stream->Finish();
+    }
+    clearCancelHook(out);
+    if (out.done)
+    {
+        out.done->Run();
     }
 }
 
-void RpcChannel::onMessage(const StreamConnectionPtr& conn, Buffer* buff)
+void RpcChannel::onConnection(size_t index, const StreamConnectionPtr& conn)
 {
-    while (buff->readableBytes() > sizeof(int32_t))
+    Connection& connection = connections_[index];
+    if (conn->connected())
     {
-        const int32_t len = buff->peekInt32();
-        if (buff->readableBytes() > (len + sizeof(int32_t)))
+        conn->setTcpNoDelay(true);
+        std::unique_lock<std::mutex> lock(mutex_);
+        // 对端可能换了进程, 分配的 id 和支持的特性不一定相同
+        connection.method_ids_.clear();
+        connection.fixed_header_ = false;
+        connection.compression_  = false;
+        connection.conn_         = conn;
+        lock.unlock();
+        RpcStream::WatchHighWaterMark(conn, std::bind(&RpcChannel::connectionStreams, this, index));
+        return;
+    }
+
+    // 连接断开后不会再有响应, 这个连接上未完成的调用全部失败
+    std::vector<OutstandingCall> out;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        connection.conn_.reset();
+        for (std::map<int64_t, OutstandingCall>::iterator it = out_.begin(); it != out_.end();)
         {
-            std::string meta_data(buff->peek() + sizeof(int32_t), len);
-            RpcMeta meta_proto;
-            meta_proto.ParseFromString(meta_data);
-            int length = sizeof(int32_t) + len + meta_proto.data_size();
-            if (buff->readableBytes() >= length)
+            if (it->second.connection == index)
             {
-                int64_t id          = meta_proto.id();
-                OutstandingCall out = { NULL, NULL };
-                {
-                    std::unique_lock<std::mutex> lock(mutex_);
-                    std::map<int64_t, OutstandingCall>::iterator it = out_.find(id);
-                    if (it != out_.end())
-                    {
-                        out = it->second;
-                        out_.erase(it);
-                    }
-                }
+                out.push_back(it->second);
+                it = out_.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+        connection.outstanding_ = 0;
+    }
+    for (auto& call : out)
+    {
+        if (call.timer.valid())
+        {
+            loop_->cancel(call.timer);
+        }
+        failCall(call, "connection closed");
+    }
+}
+
+void RpcChannel::onStreamFrame(const RpcMeta& meta, const StringPiece& payload)
+{
+    std::shared_ptr<RpcStream> stream;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        std::map<int64_t, OutstandingCall>::iterator it = out_.find(static_cast<int64_t>(meta.id()));
+        if (it != out_.end())
+        {
+            stream = it->second.stream;
+        }
+    }
+    // 调用已经结束时迟到的帧直接丢弃
+    if (!stream)
+    {
+        return;
+    }
+
+    if (!stream->OnFrame(meta, payload))
+    {
+        LOG_WARNING << "RpcChannel: unknown stream frame " << meta.stream();
+    }
+}
+
+std::vector<std::shared_ptr<RpcStream>> RpcChannel::connectionStreams(size_t index)
+{
+    std::vector<std::shared_ptr<RpcStream>> streams;
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (auto& it : out_)
+    {
+        if (it.second.connection == index && it.second.stream)
+        {
+            streams.push_back(it.second.stream);
+        }
+    }
+    return streams;
+}
 
-                if (out.response)
+void RpcChannel::onTimeout(int64_t id)
+{
+    OutstandingCall out;
+    if (!takeCall(id, &out))
+    {
+        return;
+    }
+
+    size_t endpoint = 0;
+    bool eject      = false;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        endpoint = connections_[out.connection].endpoint_;
+        eject    = ++endpoints_[endpoint].failures_ >= kMaxConsecutiveFailures;
+    }
+    failCall(out, "deadline exceeded");
+    if (eject)
+    {
+        ejectEndpoint(endpoint);
+    }
+}
+
+void RpcChannel::onCancel(int64_t id)
+{
+    OutstandingCall out;
+    if (takeCall(id, &out))
+    {
+        failCall(out, "canceled");
+    }
+}
+
+void RpcChannel::ejectEndpoint(size_t endpoint)
+{
+    std::vector<StreamConnectionPtr> conns;
+    int eject_ms = 0;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        Endpoint& state      = endpoints_[endpoint];
+        eject_ms             = state.eject_ms_;
+        state.failures_      = 0;
+        state.ejected_until_ = Clock::now() + std::chrono::milliseconds(eject_ms);
+        state.eject_ms_      = std::min(eject_ms * 2, kMaxEjectMs);
+        for (auto& connection : connections_)
+        {
+            if (connection.endpoint_ == endpoint)
+            {
+                StreamConnectionPtr conn = connection.conn_.lock();
+                if (conn)
                 {
-                    out.response->ParseFromString(
-                        std::string(buff->peek() + len + sizeof(int32_t), meta_proto.data_size()));
-                    if (out.done)
-                    {
-                        out.done->Run();
-                    }
+                    conns.push_back(conn);
                 }
+                // 立即停止选择, 不必等断开回调
+                connection.conn_.reset();
+            }
+        }
+    }
 
-                buff->retrieve(length);
-                continue;
+    LOG_WARNING << "RpcChannel: eject " << endpoints_[endpoint].addr_.toString() << " for " << eject_ms
+                << " ms after " << kMaxConsecutiveFailures << " consecutive timeouts";
+    for (auto& conn : conns)
+    {
+        conn->forceClose();
+    }
+}
+
+int RpcChannel::pickConnection()
+{
+    TimePoint now;
+    candidates_.clear();
+    for (size_t i = 0; i < connections_.size(); ++i)
+    {
+        if (connections_[i].conn_.expired())
+        {
+            continue;
+        }
+        // 摘除期间重连上的连接也先不用
+        Endpoint& endpoint = endpoints_[connections_[i].endpoint_];
+        if (endpoint.ejected_until_ != TimePoint())
+        {
+            if (now == TimePoint())
+            {
+                now = Clock::now();
             }
-            else
+            if (now < endpoint.ejected_until_)
             {
-                break;
+                continue;
             }
+            endpoint.ejected_until_ = TimePoint();
         }
-        else
+        candidates_.push_back(i);
+    }
+    if (candidates_.empty())
+    {
+        return -1;
+    }
+
+    size_t picked = candidates_[next_++ % candidates_.size()];
+    switch (policy_)
+    {
+    case kLeastOutstanding:
+        // 从轮转位置开始比较, 未完成数相同时不会总落在第一个连接上
+        for (size_t i : candidates_)
         {
-            break;
+            if (connections_[i].outstanding_ < connections_[picked].outstanding_)
+            {
+                picked = i;
+            }
         }
+        break;
+    case kPowerOfTwoChoices:
+    {
+        size_t a = candidates_[rand_() % candidates_.size()];
+        size_t b = candidates_[rand_() % candidates_.size()];
+        picked   = connections_[a].outstanding_ <= connections_[b].outstanding_ ? a : b;
+        break;
     }
+    default:
+        break;
+    }
+    return static_cast<int>(picked);
 }
 
-void RpcChannel::onConnection(const StreamConnectionPtr& conn)
+bool RpcChannel::takeCall(int64_t id, OutstandingCall* call)
 {
-    if (conn->connected())
+    std::unique_lock<std::mutex> lock(mutex_);
+    std::map<int64_t, OutstandingCall>::iterator it = out_.find(id);
+    if (it == out_.end())
+    {
+        return false;
+    }
+    *call = it->second;
+    out_.erase(it);
+    --connections_[call->connection].outstanding_;
+    if (call->timer.valid())
+    {
+        loop_->cancel(call->timer);
+    }
+    return true;
+}
+
+void RpcChannel::failCall(const OutstandingCall& call, const std::string& reason)
+{
+    // 超时或取消时让服务端也停下来, 连接已断开时只在本地结束
+    if (call.stream)
+    {
+        call.stream->Cancel();
+    }
+    if (call.controller)
+    {
+        clearCancelHook(call);
+        call.controller->SetFailed(reason);
+    }
+    if (call.done)
+    {
+        call.done->Run();
+    }
+}
+
+void RpcChannel::clearCancelHook(const OutstandingCall& call)
+{
+    RpcController* rpc_controller = dynamic_cast<RpcController*>(call.controller);
+    if (rpc_controller)
     {
-        conn_ = conn;
+        rpc_controller->ClearCancelHook();
     }
 }
 
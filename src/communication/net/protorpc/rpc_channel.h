@@ -1,9 +1,14 @@
 #ifndef _RPC_CHANNLE_H_
 #define _RPC_CHANNLE_H
 #include "StreamClient.h"
+#include "rpc_codec.h"
+#include "rpc_stream.h"
 #include <mutex>
 #include <map>
+#include <random>
+#include <vector>
 #include "InetAddress.h"
+#include "TimerId.h"
 #include "google/protobuf/service.h"
 
 namespace toyBasket
@@ -11,29 +16,132 @@ namespace toyBasket
 class RpcChannel : public google::protobuf::RpcChannel
 {
 public:
+    // 多个连接之间选择发送连接的方式
+    enum LoadBalance
+    {
+        kRoundRobin,        // 依次轮转
+        kLeastOutstanding,  // 未完成调用最少的连接
+        kPowerOfTwoChoices, // 随机取两个连接, 选未完成调用较少的一个
+    };
+
+    // 没有在 RpcController 上单独设置超时的调用使用这个值
+    static const int64_t kDefaultTimeoutMs = 10000;
+    // 连续超时这么多次的节点被摘除, 断开的连接由 Connector 重连, 摘除期满且连上后重新参与选择
+    static const int kMaxConsecutiveFailures = 3;
+    // 摘除时长, 与 Connector 的重试间隔一样每次翻倍, 节点恢复响应后复位
+    static const int kInitEjectMs = 500;
+    static const int kMaxEjectMs  = 30 * 1000;
+
     RpcChannel(EventLoop* loop, const InetAddress& serverAddr);
+    // 每个节点建立 connections_per_endpoint 个连接, 所有连接都在 loop 上
+    RpcChannel(EventLoop* loop, const std::vector<InetAddress>& endpoints, int connections_per_endpoint = 1,
+               LoadBalance policy = kRoundRobin);
     virtual ~RpcChannel();
 
     void connect();
+    // 单位毫秒, 0 表示不设超时; 须在发起调用之前设置
+    void SetDefaultTimeout(int64_t timeout_ms)
+    {
+        default_timeout_ms_ = timeout_ms;
+    }
+    // 是否向服务端申请固定头帧, 默认申请; 服务端同意后该连接上已知 id 的方法改用固定头帧
+    void SetFixedHeader(bool on)
+    {
+        fixed_header_ = on;
+    }
+    // 是否把同一轮 loop 里(或两次唤醒之间从其它线程)发起的请求合并成一次写, 默认合并; 须在发起调用之前设置
+    // 对延迟敏感的单个调用可以用 RpcController::SetImmediateSend 立即发送
+    void SetWriteCoalescing(bool on)
+    {
+        write_coalescing_ = on;
+    }
+    // 序列化后不小于 threshold 字节的请求压缩发送, 0 表示不压缩(默认); 须在发起调用之前设置
+    // 只在服务端表示支持压缩的连接上生效, 响应是否压缩由服务端的设置决定
+    void SetCompressThreshold(size_t threshold)
+    {
+        compress_threshold_ = threshold;
+    }
+    // 单个方法的阈值, 覆盖 SetCompressThreshold; 已经压缩过的数据(图片等)可以设为 0 关掉
+    void SetMethodCompressThreshold(const ::google::protobuf::MethodDescriptor* method, size_t threshold)
+    {
+        method_compress_threshold_[method] = threshold;
+    }
     void CallMethod(const ::google::protobuf::MethodDescriptor* method, ::google::protobuf::RpcController* controller,
                     const ::google::protobuf::Message* request, ::google::protobuf::Message* response,
                     ::google::protobuf::Closure* done) override;
 
 private:
-    void onMessage(const StreamConnectionPtr& conn, Buffer* buff);
-    void onConnection(const StreamConnectionPtr& conn);
+    void onFrame(const StreamConnectionPtr& conn, const StringPiece& frame);
+    void onHeaderFrame(const StreamConnectionPtr& conn, const RpcHeader& header, const StringPiece& payload);
+    // 两种帧的响应都在这里结束调用, error_text 为 NULL 表示成功
+    void onResponse(int64_t id, uint32_t method_id, uint32_t features, const std::string* error_text,
+                    const StringPiece& payload, bool compressed);
+    void onConnection(size_t index, const StreamConnectionPtr& conn);
+    // 流式调用的消息, 额度和结束
+    void onStreamFrame(const RpcMeta& meta, const StringPiece& payload);
+    // 超时和取消都在 loop 线程上结束调用, 与响应到达互斥, done 只会执行一次
+    void onTimeout(int64_t id);
+    void onCancel(int64_t id);
 
 private:
+    struct Connection
+    {
+        std::unique_ptr<StreamClient> client_;
+        std::weak_ptr<StreamConnection> conn_; // 未连上或已被摘除时为空
+        size_t endpoint_;
+        int outstanding_;
+        // 服务端随响应带回的 method_id, 每次连上后重新学习
+        std::map<const ::google::protobuf::MethodDescriptor*, uint32_t> method_ids_;
+        bool fixed_header_; // 服务端已同意使用固定头帧
+        bool compression_;  // 服务端可以解压请求
+    };
+    struct Endpoint
+    {
+        InetAddress addr_;
+        int failures_;            // 连续超时的次数
+        int eject_ms_;            // 下次摘除的时长
+        TimePoint ejected_until_; // 默认值表示未被摘除
+    };
     struct OutstandingCall
     {
         ::google::protobuf::Message* response;
         ::google::protobuf::Closure* done;
+        ::google::protobuf::RpcController* controller;
+        TimerId timer;
+        size_t connection; // connections_ 的下标
+        const ::google::protobuf::MethodDescriptor* method;
+        std::shared_ptr<RpcStream> stream; // 只有流式调用有
     };
-    std::unique_ptr<StreamClient> client_;
-    std::weak_ptr<StreamConnection> conn_;
+    // 按 policy_ 选一个可用的连接, 没有时返回 -1; 须持有 mutex_
+    int pickConnection();
+    // 把调用从 out_ 中取出并撤掉它的定时器, 已经结束时返回 false
+    bool takeCall(int64_t id, OutstandingCall* call);
+    void failCall(const OutstandingCall& call, const std::string& reason);
+    // 调用结束后 controller 上的取消钩子不再有用, 摘掉它
+    static void clearCancelHook(const OutstandingCall& call);
+    // 连接上所有进行中的流
+    std::vector<std::shared_ptr<RpcStream>> connectionStreams(size_t index);
+    // 断开节点的所有连接, 连接上未完成的调用随断开一起失败
+    void ejectEndpoint(size_t endpoint);
+
+    EventLoop* loop_;
+    RpcCodec codec_;
+    LoadBalance policy_;
+    std::vector<Endpoint> endpoints_;
+    std::vector<Connection> connections_;
     std::mutex mutex_;
     int64_t index_;
     std::map<int64_t, OutstandingCall> out_;
+    size_t next_;               // kRoundRobin 的下一个位置
+    std::minstd_rand rand_;
+    std::vector<size_t> candidates_;
+    int64_t default_timeout_ms_;
+    bool fixed_header_;
+    bool write_coalescing_;
+    size_t compress_threshold_;
+    std::map<const ::google::protobuf::MethodDescriptor*, size_t> method_compress_threshold_;
+    // 定时器和取消回调只持有它的 weak_ptr, 析构后到期的回调什么也不做
+    std::shared_ptr<bool> alive_;
 };
 }
 
@@ -0,0 +1,317 @@
+#include "rpc_codec.h"
+#include "Lz4Codec.h"
+#include "rpc_meta.pb.h"
+#include <arpa/inet.h>
+#include <endian.h>
+#include <memory>
+#include <string.h>
+
+namespace toyBasket
+{
+
+// 压缩和解压用的缓冲区, 每个线程一份
+struct CompressScratch
+{
+    CompressScratch()
+        : unpacked_size_(0)
+    {
+    }
+
+    Lz4Codec lz4_;
+    std::string raw_;
+    std::string packed_;
+    std::unique_ptr<char[]> unpacked_; // 解压的目标, 不像 std::string::resize 那样先清零
+    size_t unpacked_size_;
+};
+
+static CompressScratch& Scratch()
+{
+    static thread_local CompressScratch scratch;
+    return scratch;
+}
+
+// 偶尔的大消息不让缓冲区一直占着内存
+static void TrimScratch(CompressScratch* scratch)
+{
+    const size_t kMaxScratchSize = 4 * 1024 * 1024;
+    if (scratch->raw_.capacity() > kMaxScratchSize)
+    {
+        std::string().swap(scratch->raw_);
+    }
+    if (scratch->packed_.capacity() > kMaxScratchSize)
+    {
+        std::string().swap(scratch->packed_);
+    }
+    if (scratch->unpacked_size_ > kMaxScratchSize)
+    {
+        scratch->unpacked_.reset();
+        scratch->unpacked_size_ = 0;
+    }
+}
+
+// payload 达到阈值时在线程的缓冲区里序列化并尝试压缩, data 指向要发送的字节, 压缩后更短时才用压缩的结果
+// 未达到阈值时返回 false, 由调用方直接序列化 payload
+static bool EncodePayload(const ::google::protobuf::Message& payload, size_t payload_size, size_t threshold,
+                          StringPiece* data, bool* compressed)
+{
+    if (threshold == 0 || payload_size < threshold || payload_size > Lz4Codec::kMaxInputSize)
+    {
+        return false;
+    }
+
+    CompressScratch& scratch = Scratch();
+    scratch.raw_.clear();
+    payload.AppendToString(&scratch.raw_);
+    const size_t raw_size = scratch.raw_.size();
+
+    scratch.packed_.resize(sizeof(uint32_t) + Lz4Codec::compressBound(raw_size));
+    uint32_t be32 = htonl(static_cast<uint32_t>(raw_size));
+    memcpy(&scratch.packed_[0], &be32, sizeof be32);
+    const size_t packed_size =
+        sizeof be32 + scratch.lz4_.compress(scratch.raw_.data(), raw_size, &scratch.packed_[sizeof be32]);
+
+    *compressed = packed_size < raw_size;
+    if (*compressed)
+    {
+        *data = StringPiece(scratch.packed_.data(), static_cast<int>(packed_size));
+    }
+    else
+    {
+        *data = StringPiece(scratch.raw_.data(), static_cast<int>(raw_size));
+    }
+    return true;
+}
+
+bool ParseRpcPayload(const StringPiece& payload, bool compressed, ::google::protobuf::Message* message)
+{
+    if (!compressed)
+    {
+        return message->ParseFromArray(payload.data(), payload.size());
+    }
+
+    uint32_t be32 = 0;
+    if (static_cast<size_t>(payload.size()) < sizeof be32)
+    {
+        return false;
+    }
+    memcpy(&be32, payload.data(), sizeof be32);
+    const size_t raw_size    = ntohl(be32);
+    const size_t packed_size = static_cast<size_t>(payload.size()) - sizeof be32;
+    // 原始长度由对端给出, 超出 LZ4 的最大压缩比时不必为它分配内存
+    if (raw_size > LengthHeaderCodec::kDefaultMaxFrameSize || raw_size > Lz4Codec::decompressBound(packed_size))
+    {
+        return false;
+    }
+
+    CompressScratch& scratch = Scratch();
+    if (scratch.unpacked_size_ < raw_size)
+    {
+        scratch.unpacked_.reset(new char[raw_size]);
+        scratch.unpacked_size_ = raw_size;
+    }
+    const int n = Lz4Codec::decompress(payload.data() + sizeof be32, packed_size, scratch.unpacked_.get(), raw_size);
+    const bool ok =
+        n >= 0 && static_cast<size_t>(n) == raw_size && message->ParseFromArray(scratch.unpacked_.get(), n);
+    TrimScratch(&scratch);
+    return ok;
+}
+
+bool ParseRpcFrame(const StringPiece& frame, RpcMeta* meta, StringPiece* payload)
+{
+    const size_t frame_size = static_cast<size_t>(frame.size());
+    uint32_t meta_size      = 0;
+    int n                   = LengthHeaderCodec::decodeVarint32(frame.data(), frame_size, &meta_size);
+    if (n <= 0 || meta_size > frame_size - static_cast<size_t>(n))
+    {
+        return false;
+    }
+
+    if (!meta->ParseFromArray(frame.data() + n, static_cast<int>(meta_size)))
+    {
+        return false;
+    }
+
+    const size_t used = static_cast<size_t>(n) + meta_size;
+    if (meta->data_size() < 0 || static_cast<size_t>(meta->data_size()) != frame_size - used)
+    {
+        return false;
+    }
+    *payload = StringPiece(frame.data() + used, static_cast<int>(frame_size - used));
+    return true;
+}
+
+void SerializeRpcFrame(const LengthHeaderCodec& codec, RpcMeta* meta, const ::google::protobuf::Message& payload,
+                       std::string* out, size_t compress_threshold)
+{
+    size_t payload_size = payload.ByteSizeLong();
+    StringPiece encoded;
+    bool compressed   = false;
+    const bool encode = EncodePayload(payload, payload_size, compress_threshold, &encoded, &compressed);
+    if (encode)
+    {
+        payload_size = static_cast<size_t>(encoded.size());
+        meta->set_compressed(compressed);
+    }
+    meta->set_data_size(static_cast<int32_t>(payload_size));
+    const size_t meta_size = meta->ByteSizeLong();
+
+    char varint[LengthHeaderCodec::kMaxVarint32Size];
+    const size_t varint_size = LengthHeaderCodec::encodeVarint32(static_cast<uint32_t>(meta_size), varint);
+    const size_t frame_size  = varint_size + meta_size + payload_size;
+
+    // 一次分配, 之后整块交给连接发送
+    out->reserve(out->size() + codec.headerSize(frame_size) + frame_size);
+    codec.appendHeader(out, frame_size);
+    out->append(varint, varint_size);
+    meta->AppendToString(out);
+    if (encode)
+    {
+        out->append(encoded.data(), payload_size);
+        TrimScratch(&Scratch());
+    }
+    else
+    {
+        payload.AppendToString(out);
+    }
+}
+
+int PeekRpcHeader(const char* data, size_t len, RpcHeader* header)
+{
+    if (len < kRpcHeaderSize)
+    {
+        return 0;
+    }
+
+    uint16_t magic = 0;
+    memcpy(&magic, data, sizeof magic);
+    if (ntohs(magic) != kRpcMagic || static_cast<uint8_t>(data[2]) != kRpcVersion)
+    {
+        return -1;
+    }
+    header->flags = static_cast<uint8_t>(data[3]);
+
+    uint64_t be64 = 0;
+    uint32_t be32 = 0;
+    memcpy(&be64, data + 4, sizeof be64);
+    header->id = be64toh(be64);
+    memcpy(&be32, data + 12, sizeof be32);
+    header->method_id = ntohl(be32);
+    memcpy(&be32, data + 16, sizeof be32);
+    header->payload_size = ntohl(be32);
+    header->timeout_ms   = 0;
+    if ((header->flags & kRpcFlagDeadline) == 0)
+    {
+        return static_cast<int>(kRpcHeaderSize);
+    }
+
+    if (len < kRpcHeaderSize + sizeof be32)
+    {
+        return 0;
+    }
+    memcpy(&be32, data + kRpcHeaderSize, sizeof be32);
+    header->timeout_ms = ntohl(be32);
+    return static_cast<int>(kRpcHeaderSize + sizeof be32);
+}
+
+static void AppendRpcHeader(const RpcHeader& header, std::string* out)
+{
+    char buf[kRpcHeaderSize + sizeof(uint32_t)];
+    uint16_t be16 = htons(kRpcMagic);
+    uint64_t be64 = htobe64(header.id);
+    uint32_t be32 = htonl(header.method_id);
+    memcpy(buf, &be16, sizeof be16);
+    buf[2] = static_cast<char>(kRpcVersion);
+    buf[3] = static_cast<char>(header.flags);
+    memcpy(buf + 4, &be64, sizeof be64);
+    memcpy(buf + 12, &be32, sizeof be32);
+    be32 = htonl(header.payload_size);
+    memcpy(buf + 16, &be32, sizeof be32);
+
+    size_t len = kRpcHeaderSize;
+    if (header.flags & kRpcFlagDeadline)
+    {
+        be32 = htonl(header.timeout_ms);
+        memcpy(buf + kRpcHeaderSize, &be32, sizeof be32);
+        len += sizeof be32;
+    }
+    out->append(buf, len);
+}
+
+void SerializeRpcHeaderFrame(RpcHeader* header, const ::google::protobuf::Message& payload, std::string* out,
+                             size_t compress_threshold)
+{
+    const size_t payload_size = payload.ByteSizeLong();
+    StringPiece encoded;
+    bool compressed = false;
+    if (!EncodePayload(payload, payload_size, compress_threshold, &encoded, &compressed))
+    {
+        header->payload_size = static_cast<uint32_t>(payload_size);
+        out->reserve(out->size() + kRpcHeaderSize + sizeof(uint32_t) + header->payload_size);
+        AppendRpcHeader(*header, out);
+        payload.AppendToString(out);
+        return;
+    }
+
+    if (compressed)
+    {
+        header->flags |= kRpcFlagCompressed;
+    }
+    header->payload_size = static_cast<uint32_t>(encoded.size());
+    out->reserve(out->size() + kRpcHeaderSize + sizeof(uint32_t) + header->payload_size);
+    AppendRpcHeader(*header, out);
+    out->append(encoded.data(), header->payload_size);
+    TrimScratch(&Scratch());
+}
+
+void SerializeRpcHeaderFrame(RpcHeader* header, const std::string& error_text, std::string* out)
+{
+    header->flags |= kRpcFlagFailed;
+    header->payload_size = static_cast<uint32_t>(error_text.size());
+    AppendRpcHeader(*header, out);
+    out->append(error_text);
+}
+
+RpcCodec::RpcCodec(const LengthHeaderCodec::FrameCallback& meta_cb, const HeaderFrameCallback& header_cb)
+    : codec_(meta_cb, LengthHeaderCodec::kFixed32)
+    , header_callback_(header_cb)
+{
+}
+
+void RpcCodec::onMessage(const StreamConnectionPtr& conn, Buffer* buf)
+{
+    const char magic0 = static_cast<char>(kRpcMagic >> 8);
+    while (buf->readableBytes() > 0)
+    {
+        if (*buf->peek() != magic0)
+        {
+            if (!codec_.parseFrame(conn, buf))
+            {
+                break;
+            }
+            continue;
+        }
+
+        RpcHeader header;
+        int n = PeekRpcHeader(buf->peek(), buf->readableBytes(), &header);
+        if (n == 0)
+        {
+            break;
+        }
+        if (n < 0 || header.payload_size > codec_.maxFrameSize())
+        {
+            LOG_ERROR << "RpcCodec: invalid header from " << conn->name();
+            buf->retrieveAll();
+            conn->forceClose();
+            break;
+        }
+
+        const size_t total = static_cast<size_t>(n) + header.payload_size;
+        if (buf->readableBytes() < total)
+        {
+            break;
+        }
+        header_callback_(conn, header, StringPiece(buf->peek() + n, static_cast<int>(header.payload_size)));
+        buf->retrieve(total);
+    }
+}
+}
\ No newline at end of file
@@ -0,0 +1,107 @@
+#ifndef _RPC_CODEC_H
+#define _RPC_CODEC_H
+
+#include <stdint.h>
+#include <string>
+#include "LengthHeaderCodec.h"
+#include "StringPiece.h"
+#include "google/protobuf/message.h"
+
+namespace toyBasket
+{
+class RpcMeta;
+
+// 帧格式(由 LengthHeaderCodec 分帧):
+// +------------------+---------+-----------------------------+
+// | varint meta size | RpcMeta | payload (meta.data_size())  |
+// +------------------+---------+-----------------------------+
+
+// 解析一帧, payload 指向 frame 内部, 不拷贝
+bool ParseRpcFrame(const StringPiece& frame, RpcMeta* meta, StringPiece* payload);
+
+// 序列化一帧(含长度头)追加到 out, 会设置 meta 的 data_size
+// payload 不小于 compress_threshold 且压缩后更短时发送压缩的 payload 并设置 meta 的 compressed, 0 表示不压缩
+void SerializeRpcFrame(const LengthHeaderCodec& codec, RpcMeta* meta, const ::google::protobuf::Message& payload,
+                       std::string* out, size_t compress_threshold = 0);
+
+// 压缩的 payload: 4 字节网络序的原始长度, 之后是一个 LZ4 block(见 Lz4Codec).
+// 是否压缩由 RpcMeta.compressed 或固定头的 kRpcFlagCompressed 标明, 双方通过 kRpcFeatureCompression 协商.
+// 压缩用的缓冲区和哈希表每个线程一份, 在 loop 线程和工作线程上都不会为每次调用重新分配.
+const uint32_t kRpcFeatureCompression = 0x02; // RpcMeta.features 中的位
+
+// 解析 payload, 需要时先解压; 原始长度超过 kDefaultMaxFrameSize 的视为非法
+bool ParseRpcPayload(const StringPiece& payload, bool compressed, ::google::protobuf::Message* message);
+
+// batched 时与同一轮 loop 里的其它帧合并, 在本轮结束时一次写出, 否则立即发送
+inline void SendRpcFrame(const StreamConnectionPtr& conn, std::string&& frame, bool batched)
+{
+    if (batched)
+    {
+        conn->sendBatched(std::move(frame));
+    }
+    else
+    {
+        conn->send(std::move(frame));
+    }
+}
+
+// 固定头帧, 连接双方通过 RpcMeta.features 协商后才使用, 不经过 LengthHeaderCodec:
+// +-------+---------+-------+---------+-----------+--------------+--------------------+---------+
+// | magic | version | flags | call id | method id | payload size | timeout_ms (可选)  | payload |
+// |   2   |    1    |   1   |    8    |     4     |      4       |         4          |         |
+// +-------+---------+-------+---------+-----------+--------------+--------------------+---------+
+// 整数都是网络字节序. magic 的首字节大于 kFixed32 长度头在 64MB 帧长下可能出现的首字节,
+// 收端只看一个字节就能区分两种帧.
+const uint32_t kRpcFeatureFixedHeader = 0x01; // RpcMeta.features 中的位
+
+const uint16_t kRpcMagic               = 0xB7C5;
+const uint8_t kRpcVersion              = 1;
+const uint8_t kRpcFlagFailed           = 0x01; // payload 是错误信息
+const uint8_t kRpcFlagDeadline         = 0x02; // 带 timeout_ms
+const uint8_t kRpcFlagCompressed       = 0x04; // payload 是压缩的
+const uint8_t kRpcFlagAcceptCompressed = 0x08; // 请求方可以接收压缩的响应
+const size_t kRpcHeaderSize            = 20;   // 不含 timeout_ms
+
+struct RpcHeader
+{
+    uint8_t flags;
+    uint64_t id;
+    uint32_t method_id;
+    uint32_t payload_size;
+    uint32_t timeout_ms; // flags 含 kRpcFlagDeadline 时有效
+};
+
+// 直接从 data 读固定头, 不拷贝也不分配
+// 返回头部字节数, 0 表示数据不够, -1 表示不是合法的固定头
+int PeekRpcHeader(const char* data, size_t len, RpcHeader* header);
+
+// 序列化一帧固定头帧追加到 out, 会设置 header 的 payload_size, compress_threshold 同 SerializeRpcFrame
+void SerializeRpcHeaderFrame(RpcHeader* header, const ::google::protobuf::Message& payload, std::string* out,
+                             size_t compress_threshold = 0);
+// 失败的响应, payload 是错误信息
+void SerializeRpcHeaderFrame(RpcHeader* header, const std::string& error_text, std::string* out);
+
+// 同一个连接上两种帧可以交替出现: 首字节是 magic 的为固定头帧, 其余交给 LengthHeaderCodec
+class RpcCodec
+{
+public:
+    typedef std::function<void(const StreamConnectionPtr&, const RpcHeader& header, const StringPiece& payload)>
+        HeaderFrameCallback;
+
+    // 长度头固定为 kFixed32, 帧长上限即 LengthHeaderCodec 的默认值, 两种帧才不会混淆
+    RpcCodec(const LengthHeaderCodec::FrameCallback& meta_cb, const HeaderFrameCallback& header_cb);
+
+    void onMessage(const StreamConnectionPtr& conn, Buffer* buf);
+
+    const LengthHeaderCodec& length_codec() const
+    {
+        return codec_;
+    }
+
+private:
+    LengthHeaderCodec codec_;
+    HeaderFrameCallback header_callback_;
+};
+}
+
+#endif
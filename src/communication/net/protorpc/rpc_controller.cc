@@ -0,0 +1,144 @@
+#include "rpc_controller.h"
+#include "rpc_stream.h"
+
+namespace toyBasket
+{
+
+RpcController::RpcController()
+    : failed_(false)
+    , timeout_ms_(0)
+    , immediate_send_(false)
+    , canceled_(false)
+    , cancel_callback_(NULL)
+{
+}
+
+RpcController::~RpcController()
+{
+    // NotifyOnCancel 的回调总要执行一次, 没被取消时在调用结束后执行
+    if (cancel_callback_)
+    {
+        cancel_callback_->Run();
+    }
+}
+
+void RpcController::Reset()
+{
+    google::protobuf::Closure* callback = NULL;
+    std::shared_ptr<RpcStream> stream;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        failed_   = false;
+        canceled_ = false;
+        deadline_ = TimePoint();
+        error_text_.clear();
+        cancel_hook_ = nullptr;
+        std::swap(callback, cancel_callback_);
+        stream.swap(stream_);
+    }
+    if (callback)
+    {
+        callback->Run();
+    }
+}
+
+bool RpcController::Failed() const
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    return failed_;
+}
+
+std::string RpcController::ErrorText() const
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    return error_text_;
+}
+
+void RpcController::StartCancel()
+{
+    std::function<void()> hook;
+    google::protobuf::Closure* callback = NULL;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (canceled_)
+        {
+            return;
+        }
+        canceled_ = true;
+        hook.swap(cancel_hook_);
+        std::swap(callback, cancel_callback_);
+    }
+    // 锁外执行, hook 会回到 RpcChannel 加锁
+    if (hook)
+    {
+        hook();
+    }
+    if (callback)
+    {
+        callback->Run();
+    }
+}
+
+void RpcController::SetFailed(const std::string& reason)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    failed_     = true;
+    error_text_ = reason;
+}
+
+bool RpcController::IsCanceled() const
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    // 流式调用还可能被调用方的 kStreamCancel 或连接断开取消
+    return canceled_ || (deadline_ != TimePoint() && Clock::now() >= deadline_) || (stream_ && stream_->IsCanceled());
+}
+
+void RpcController::NotifyOnCancel(google::protobuf::Closure* callback)
+{
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (!canceled_)
+        {
+            cancel_callback_ = callback;
+            return;
+        }
+    }
+    callback->Run();
+}
+
+RpcStream* RpcController::Stream()
+{
+    return GetStream().get();
+}
+
+std::shared_ptr<RpcStream> RpcController::GetStream()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!stream_)
+    {
+        stream_ = std::make_shared<RpcStream>();
+    }
+    return stream_;
+}
+
+bool RpcController::SetCancelHook(std::function<void()> hook)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (canceled_)
+    {
+        return false;
+    }
+    cancel_hook_ = std::move(hook);
+    return true;
+}
+
+void RpcController::ClearCancelHook()
+{
+    std::function<void()> hook;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        hook.swap(cancel_hook_);
+    }
+}
+
+} // namespace toyBasket
@@ -0,0 +1,85 @@
+#ifndef _RPC_CONTROLLER_H
+#define _RPC_CONTROLLER_H
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include "Callbacks.h"
+#include "google/protobuf/service.h"
+
+namespace toyBasket
+{
+class RpcStream;
+
+// 客户端: 设置单次调用的超时, done 执行后用 Failed/ErrorText 查询结果, StartCancel 可提前结束调用
+// 服务端: 方法实现用 SetFailed 把错误带回调用方, 调用方的截止时间已过时 IsCanceled 返回 true
+class RpcController : public google::protobuf::RpcController
+{
+public:
+    RpcController();
+    virtual ~RpcController();
+
+    void Reset() override;
+    bool Failed() const override;
+    std::string ErrorText() const override;
+    void StartCancel() override;
+    void SetFailed(const std::string& reason) override;
+    bool IsCanceled() const override;
+    void NotifyOnCancel(google::protobuf::Closure* callback) override;
+
+    // 单位毫秒, 0 表示使用 RpcChannel 的默认超时
+    void SetTimeout(int64_t timeout_ms)
+    {
+        timeout_ms_ = timeout_ms;
+    }
+    int64_t Timeout() const
+    {
+        return timeout_ms_;
+    }
+
+    // 不与其它帧合并, 立即发送: 调用方设置时作用于请求, 服务端的方法实现在执行 done 之前设置时作用于响应
+    void SetImmediateSend(bool on)
+    {
+        immediate_send_ = on;
+    }
+    bool ImmediateSend() const
+    {
+        return immediate_send_;
+    }
+
+    // 流式方法的收发端, 见 rpc_stream.h; 调用方在发起调用之前取得并设置回调, 服务端在方法实现中取得
+    // 流式调用不使用 RpcChannel 的默认超时, 只受 SetTimeout 限制
+    RpcStream* Stream();
+
+private:
+    friend class RpcChannel;
+    friend class RpcServer;
+
+    // RpcChannel 登记, StartCancel 时用它结束对应的调用; 已经取消时返回 false
+    bool SetCancelHook(std::function<void()> hook);
+    // 调用结束时清掉, 之后的 StartCancel 不再回到 RpcChannel, 通道可能已经析构
+    void ClearCancelHook();
+    // RpcServer 按请求中的剩余时间换算出本地的截止时间
+    void SetDeadline(TimePoint deadline)
+    {
+        deadline_ = deadline;
+    }
+    std::shared_ptr<RpcStream> GetStream();
+
+private:
+    mutable std::mutex mutex_; // StartCancel 可能与 loop 线程上的完成同时发生
+    bool failed_;
+    std::string error_text_;
+    int64_t timeout_ms_;
+    bool immediate_send_;
+    bool canceled_;
+    TimePoint deadline_; // 默认值表示不限
+    std::function<void()> cancel_hook_;
+    google::protobuf::Closure* cancel_callback_;
+    std::shared_ptr<RpcStream> stream_; // 第一次取用时创建, Reset 时释放
+};
+
+}
+
+#endif
@@ -14,456 +14,633 @@
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
 #include <google/protobuf/port_def.inc>
-namespace toyBasket
-{
-class RpcMetaDefaultTypeInternal
-{
-public:
-    ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<RpcMeta> _instance;
-} _RpcMeta_default_instance_;
-} // namespace toyBasket
-static void InitDefaultsscc_info_RpcMeta_rpc_5fmeta_2eproto()
-{
-    GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-    {
-        void* ptr = &::toyBasket::_RpcMeta_default_instance_;
-        new (ptr)::toyBasket::RpcMeta();
-        ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-    }
-    ::toyBasket::RpcMeta::InitAsDefaultInstance();
-}
 
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_RpcMeta_rpc_5fmeta_2eproto
-    = { { ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0,
-          InitDefaultsscc_info_RpcMeta_rpc_5fmeta_2eproto },
-        {} };
-
-static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_rpc_5fmeta_2eproto[1];
-static constexpr ::PROTOBUF_NAMESPACE_ID::EnumDescriptor const** file_level_enum_descriptors_rpc_5fmeta_2eproto
-    = nullptr;
-static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_rpc_5fmeta_2eproto
-    = nullptr;
-
-const ::PROTOBUF_NAMESPACE_ID::uint32
-    TableStruct_rpc_5fmeta_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold)
-    = {
-          ~0u, // no _has_bits_
-          PROTOBUF_FIELD_OFFSET(::toyBasket::RpcMeta, _internal_metadata_),
-          ~0u, // no _extensions_
-          ~0u, // no _oneof_case_
-          ~0u, // no _weak_field_map_
-          PROTOBUF_FIELD_OFFSET(::toyBasket::RpcMeta, id_),
-          PROTOBUF_FIELD_OFFSET(::toyBasket::RpcMeta, server_),
-          PROTOBUF_FIELD_OFFSET(::toyBasket::RpcMeta, method_),
-          PROTOBUF_FIELD_OFFSET(::toyBasket::RpcMeta, data_size_),
-      };
-static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-    { 0, -1, sizeof(::toyBasket::RpcMeta) },
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace toyBasket {
+PROTOBUF_CONSTEXPR RpcMeta::RpcMeta(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.server_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.method_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.error_text_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.id_)*/uint64_t{0u}
+  , /*decltype(_impl_.data_size_)*/0
+  , /*decltype(_impl_.timeout_ms_)*/0u
+  , /*decltype(_impl_.method_id_)*/0u
+  , /*decltype(_impl_.failed_)*/false
+  , /*decltype(_impl_.compressed_)*/false
+  , /*decltype(_impl_.features_)*/0u
+  , /*decltype(_impl_.stream_)*/0u
+  , /*decltype(_impl_.credit_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RpcMetaDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RpcMetaDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RpcMetaDefaultTypeInternal() {}
+  union {
+    RpcMeta _instance;
+  };
 };
-
-static ::PROTOBUF_NAMESPACE_ID::Message const* const file_default_instances[] = {
-    reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::toyBasket::_RpcMeta_default_instance_),
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RpcMetaDefaultTypeInternal _RpcMeta_default_instance_;
+}  // namespace toyBasket
+static ::_pb::Metadata file_level_metadata_rpc_5fmeta_2eproto[1];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_rpc_5fmeta_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_rpc_5fmeta_2eproto = nullptr;
+
+const uint32_t TableStruct_rpc_5fmeta_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::toyBasket::RpcMeta, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::toyBasket::RpcMeta, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::toyBasket::RpcMeta, _impl_.server_),
+  PROTOBUF_FIELD_OFFSET(::toyBasket::RpcMeta, _impl_.method_),
+  PROTOBUF_FIELD_OFFSET(::toyBasket::RpcMeta, _impl_.data_size_),
+  PROTOBUF_FIELD_OFFSET(::toyBasket::RpcMeta, _impl_.timeout_ms_),
+  PROTOBUF_FIELD_OFFSET(::toyBasket::RpcMeta, _impl_.failed_),
+  PROTOBUF_FIELD_OFFSET(::toyBasket::RpcMeta, _impl_.error_text_),
+  PROTOBUF_FIELD_OFFSET(::toyBasket::RpcMeta, _impl_.method_id_),
+  PROTOBUF_FIELD_OFFSET(::toyBasket::RpcMeta, _impl_.features_),
+  PROTOBUF_FIELD_OFFSET(::toyBasket::RpcMeta, _impl_.compressed_),
+  PROTOBUF_FIELD_OFFSET(::toyBasket::RpcMeta, _impl_.stream_),
+  PROTOBUF_FIELD_OFFSET(::toyBasket::RpcMeta, _impl_.credit_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::toyBasket::RpcMeta)},
 };
 
-const char descriptor_table_protodef_rpc_5fmeta_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold)
-    = "\n\016rpc_meta.proto\022\ttoyBasket\"H\n\007RpcMeta\022\n"
-      "\n\002id\030\001 \001(\006\022\016\n\006server\030\002 \001(\t\022\016\n\006method\030\003 \001"
-      "(\t\022\021\n\tdata_size\030\004 \001(\005b\006proto3";
-static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable* const descriptor_table_rpc_5fmeta_2eproto_deps[1] = {};
-static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase* const descriptor_table_rpc_5fmeta_2eproto_sccs[1]           = {
-    &scc_info_RpcMeta_rpc_5fmeta_2eproto.base,
+static const ::_pb::Message* const file_default_instances[] = {
+  &::toyBasket::_RpcMeta_default_instance_._instance,
 };
-static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_rpc_5fmeta_2eproto_once;
-const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_rpc_5fmeta_2eproto = {
-    false,
-    false,
-    descriptor_table_protodef_rpc_5fmeta_2eproto,
+
+const char descriptor_table_protodef_rpc_5fmeta_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\016rpc_meta.proto\022\ttoyBasket\"\331\001\n\007RpcMeta\022"
+  "\n\n\002id\030\001 \001(\006\022\016\n\006server\030\002 \001(\t\022\016\n\006method\030\003 "
+  "\001(\t\022\021\n\tdata_size\030\004 \001(\005\022\022\n\ntimeout_ms\030\005 \001"
+  "(\r\022\016\n\006failed\030\006 \001(\010\022\022\n\nerror_text\030\007 \001(\t\022\021"
+  "\n\tmethod_id\030\010 \001(\r\022\020\n\010features\030\t \001(\r\022\022\n\nc"
+  "ompressed\030\n \001(\010\022\016\n\006stream\030\013 \001(\r\022\016\n\006credi"
+  "t\030\014 \001(\rb\006proto3"
+  ;
+static ::_pbi::once_flag descriptor_table_rpc_5fmeta_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_rpc_5fmeta_2eproto = {
+    false, false, 255, descriptor_table_protodef_rpc_5fmeta_2eproto,
     "rpc_meta.proto",
-    109,
-    &descriptor_table_rpc_5fmeta_2eproto_once,
-    descriptor_table_rpc_5fmeta_2eproto_sccs,
-    descriptor_table_rpc_5fmeta_2eproto_deps,
-    1,
-    0,
-    schemas,
-    file_default_instances,
-    TableStruct_rpc_5fmeta_2eproto::offsets,
-    file_level_metadata_rpc_5fmeta_2eproto,
-    1,
-    file_level_enum_descriptors_rpc_5fmeta_2eproto,
+    &descriptor_table_rpc_5fmeta_2eproto_once, nullptr, 0, 1,
+    schemas, file_default_instances, TableStruct_rpc_5fmeta_2eproto::offsets,
+    file_level_metadata_rpc_5fmeta_2eproto, file_level_enum_descriptors_rpc_5fmeta_2eproto,
     file_level_service_descriptors_rpc_5fmeta_2eproto,
 };
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_rpc_5fmeta_2eproto_getter() {
+  return &descriptor_table_rpc_5fmeta_2eproto;
+}
 
 // Force running AddDescriptors() at dynamic initialization time.
-static bool dynamic_init_dummy_rpc_5fmeta_2eproto
-    = (static_cast<void>(::PROTOBUF_NAMESPACE_ID::internal::AddDescriptors(&descriptor_table_rpc_5fmeta_2eproto)),
-       true);
-namespace toyBasket
-{
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_rpc_5fmeta_2eproto(&descriptor_table_rpc_5fmeta_2eproto);
+namespace toyBasket {
 
 // ===================================================================
 
-void RpcMeta::InitAsDefaultInstance()
-{
-}
-class RpcMeta::_Internal
-{
-public:
+class RpcMeta::_Internal {
+ public:
 };
 
-RpcMeta::RpcMeta(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-    : ::PROTOBUF_NAMESPACE_ID::Message(arena)
-{
-    SharedCtor();
-    RegisterArenaDtor(arena);
-    // @@protoc_insertion_point(arena_constructor:toyBasket.RpcMeta)
+RpcMeta::RpcMeta(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:toyBasket.RpcMeta)
 }
 RpcMeta::RpcMeta(const RpcMeta& from)
-    : ::PROTOBUF_NAMESPACE_ID::Message()
-{
-    _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-    server_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-    if (!from._internal_server().empty())
-    {
-        server_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_server(),
-                    GetArena());
-    }
-    method_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-    if (!from._internal_method().empty())
-    {
-        method_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_method(),
-                    GetArena());
-    }
-    ::memcpy(&id_, &from.id_,
-             static_cast<size_t>(reinterpret_cast<char*>(&data_size_) - reinterpret_cast<char*>(&id_))
-                 + sizeof(data_size_));
-    // @@protoc_insertion_point(copy_constructor:toyBasket.RpcMeta)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RpcMeta* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.server_){}
+    , decltype(_impl_.method_){}
+    , decltype(_impl_.error_text_){}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.data_size_){}
+    , decltype(_impl_.timeout_ms_){}
+    , decltype(_impl_.method_id_){}
+    , decltype(_impl_.failed_){}
+    , decltype(_impl_.compressed_){}
+    , decltype(_impl_.features_){}
+    , decltype(_impl_.stream_){}
+    , decltype(_impl_.credit_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.server_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.server_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_server().empty()) {
+    _this->_impl_.server_.Set(from._internal_server(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.method_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.method_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_method().empty()) {
+    _this->_impl_.method_.Set(from._internal_method(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.error_text_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_text_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_error_text().empty()) {
+    _this->_impl_.error_text_.Set(from._internal_error_text(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.id_, &from._impl_.id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.credit_) -
+    reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.credit_));
+  // @@protoc_insertion_point(copy_constructor:toyBasket.RpcMeta)
 }
 
-void RpcMeta::SharedCtor()
-{
-    ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_RpcMeta_rpc_5fmeta_2eproto.base);
-    server_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-    method_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-    ::memset(&id_, 0,
-             static_cast<size_t>(reinterpret_cast<char*>(&data_size_) - reinterpret_cast<char*>(&id_))
-                 + sizeof(data_size_));
+inline void RpcMeta::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.server_){}
+    , decltype(_impl_.method_){}
+    , decltype(_impl_.error_text_){}
+    , decltype(_impl_.id_){uint64_t{0u}}
+    , decltype(_impl_.data_size_){0}
+    , decltype(_impl_.timeout_ms_){0u}
+    , decltype(_impl_.method_id_){0u}
+    , decltype(_impl_.failed_){false}
+    , decltype(_impl_.compressed_){false}
+    , decltype(_impl_.features_){0u}
+    , decltype(_impl_.stream_){0u}
+    , decltype(_impl_.credit_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.server_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.server_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.method_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.method_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.error_text_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_text_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-RpcMeta::~RpcMeta()
-{
-    // @@protoc_insertion_point(destructor:toyBasket.RpcMeta)
-    SharedDtor();
-    _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+RpcMeta::~RpcMeta() {
+  // @@protoc_insertion_point(destructor:toyBasket.RpcMeta)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
 
-void RpcMeta::SharedDtor()
-{
-    GOOGLE_DCHECK(GetArena() == nullptr);
-    server_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-    method_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void RpcMeta::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.server_.Destroy();
+  _impl_.method_.Destroy();
+  _impl_.error_text_.Destroy();
 }
 
-void RpcMeta::ArenaDtor(void* object)
-{
-    RpcMeta* _this = reinterpret_cast<RpcMeta*>(object);
-    (void)_this;
-}
-void RpcMeta::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*)
-{
-}
-void RpcMeta::SetCachedSize(int size) const
-{
-    _cached_size_.Set(size);
-}
-const RpcMeta& RpcMeta::default_instance()
-{
-    ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_RpcMeta_rpc_5fmeta_2eproto.base);
-    return *internal_default_instance();
+void RpcMeta::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-void RpcMeta::Clear()
-{
-    // @@protoc_insertion_point(message_clear_start:toyBasket.RpcMeta)
-    ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-    // Prevent compiler warnings about cached_has_bits being unused
-    (void)cached_has_bits;
-
-    server_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-    method_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-    ::memset(&id_, 0,
-             static_cast<size_t>(reinterpret_cast<char*>(&data_size_) - reinterpret_cast<char*>(&id_))
-                 + sizeof(data_size_));
-    _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+void RpcMeta::Clear() {
+// @@protoc_insertion_point(message_clear_start:toyBasket.RpcMeta)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.server_.ClearToEmpty();
+  _impl_.method_.ClearToEmpty();
+  _impl_.error_text_.ClearToEmpty();
+  ::memset(&_impl_.id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.credit_) -
+      reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.credit_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* RpcMeta::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx)
-{
-#define CHK_(x)                       \
-    if (PROTOBUF_PREDICT_FALSE(!(x))) \
-    goto failure
-    ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena();
-    (void)arena;
-    while (!ctx->Done(&ptr))
-    {
-        ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-        ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-        CHK_(ptr);
-        switch (tag >> 3)
-        {
-        // fixed64 id = 1;
-        case 1:
-            if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 9))
-            {
-                id_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr);
-                ptr += sizeof(::PROTOBUF_NAMESPACE_ID::uint64);
-            }
-            else
-                goto handle_unusual;
-            continue;
-        // string server = 2;
-        case 2:
-            if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18))
-            {
-                auto str = _internal_mutable_server();
-                ptr      = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-                CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "toyBasket.RpcMeta.server"));
-                CHK_(ptr);
-            }
-            else
-                goto handle_unusual;
-            continue;
-        // string method = 3;
-        case 3:
-            if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26))
-            {
-                auto str = _internal_mutable_method();
-                ptr      = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-                CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "toyBasket.RpcMeta.method"));
-                CHK_(ptr);
-            }
-            else
-                goto handle_unusual;
-            continue;
-        // int32 data_size = 4;
-        case 4:
-            if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 32))
-            {
-                data_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-                CHK_(ptr);
-            }
-            else
-                goto handle_unusual;
-            continue;
-        default:
-        {
-        handle_unusual:
-            if ((tag & 7) == 4 || tag == 0)
-            {
-                ctx->SetLastTag(tag);
-                goto success;
-            }
-            ptr = UnknownFieldParse(
-                tag, _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(), ptr, ctx);
-            CHK_(ptr != nullptr);
-            continue;
-        }
-        } // switch
-    }     // while
-success:
-    return ptr;
+const char* RpcMeta::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // fixed64 id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // string server = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_server();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "toyBasket.RpcMeta.server"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string method = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_method();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "toyBasket.RpcMeta.method"));
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 data_size = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.data_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 timeout_ms = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.timeout_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool failed = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.failed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string error_text = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          auto str = _internal_mutable_error_text();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "toyBasket.RpcMeta.error_text"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 method_id = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.method_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 features = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _impl_.features_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool compressed = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _impl_.compressed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 stream = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          _impl_.stream_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 credit = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 96)) {
+          _impl_.credit_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-    ptr = nullptr;
-    goto success;
+  ptr = nullptr;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8*
-RpcMeta::_InternalSerialize(::PROTOBUF_NAMESPACE_ID::uint8* target,
-                            ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const
-{
-    // @@protoc_insertion_point(serialize_to_array_start:toyBasket.RpcMeta)
-    ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-    (void)cached_has_bits;
-
-    // fixed64 id = 1;
-    if (this->id() != 0)
-    {
-        target = stream->EnsureSpace(target);
-        target
-            = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFixed64ToArray(1, this->_internal_id(), target);
-    }
-
-    // string server = 2;
-    if (this->server().size() > 0)
-    {
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-            this->_internal_server().data(), static_cast<int>(this->_internal_server().length()),
-            ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE, "toyBasket.RpcMeta.server");
-        target = stream->WriteStringMaybeAliased(2, this->_internal_server(), target);
-    }
-
-    // string method = 3;
-    if (this->method().size() > 0)
-    {
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-            this->_internal_method().data(), static_cast<int>(this->_internal_method().length()),
-            ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE, "toyBasket.RpcMeta.method");
-        target = stream->WriteStringMaybeAliased(3, this->_internal_method(), target);
-    }
-
-    // int32 data_size = 4;
-    if (this->data_size() != 0)
-    {
-        target = stream->EnsureSpace(target);
-        target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(4, this->_internal_data_size(),
-                                                                                      target);
-    }
-
-    if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields()))
-    {
-        target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-            _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(
-                ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance),
-            target, stream);
-    }
-    // @@protoc_insertion_point(serialize_to_array_end:toyBasket.RpcMeta)
-    return target;
-}
-
-size_t RpcMeta::ByteSizeLong() const
-{
-    // @@protoc_insertion_point(message_byte_size_start:toyBasket.RpcMeta)
-    size_t total_size = 0;
-
-    ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-    // Prevent compiler warnings about cached_has_bits being unused
-    (void)cached_has_bits;
-
-    // string server = 2;
-    if (this->server().size() > 0)
-    {
-        total_size += 1 + ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(this->_internal_server());
-    }
-
-    // string method = 3;
-    if (this->method().size() > 0)
-    {
-        total_size += 1 + ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(this->_internal_method());
-    }
-
-    // fixed64 id = 1;
-    if (this->id() != 0)
-    {
-        total_size += 1 + 8;
-    }
-
-    // int32 data_size = 4;
-    if (this->data_size() != 0)
-    {
-        total_size += 1 + ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(this->_internal_data_size());
-    }
-
-    if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields()))
-    {
-        return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(_internal_metadata_, total_size,
-                                                                           &_cached_size_);
-    }
-    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-    SetCachedSize(cached_size);
-    return total_size;
-}
-
-void RpcMeta::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from)
-{
-    // @@protoc_insertion_point(generalized_merge_from_start:toyBasket.RpcMeta)
-    GOOGLE_DCHECK_NE(&from, this);
-    const RpcMeta* source = ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<RpcMeta>(&from);
-    if (source == nullptr)
-    {
-        // @@protoc_insertion_point(generalized_merge_from_cast_fail:toyBasket.RpcMeta)
-        ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-    }
-    else
-    {
-        // @@protoc_insertion_point(generalized_merge_from_cast_success:toyBasket.RpcMeta)
-        MergeFrom(*source);
-    }
+uint8_t* RpcMeta::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:toyBasket.RpcMeta)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // fixed64 id = 1;
+  if (this->_internal_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(1, this->_internal_id(), target);
+  }
+
+  // string server = 2;
+  if (!this->_internal_server().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_server().data(), static_cast<int>(this->_internal_server().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "toyBasket.RpcMeta.server");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_server(), target);
+  }
+
+  // string method = 3;
+  if (!this->_internal_method().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_method().data(), static_cast<int>(this->_internal_method().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "toyBasket.RpcMeta.method");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_method(), target);
+  }
+
+  // int32 data_size = 4;
+  if (this->_internal_data_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_data_size(), target);
+  }
+
+  // uint32 timeout_ms = 5;
+  if (this->_internal_timeout_ms() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_timeout_ms(), target);
+  }
+
+  // bool failed = 6;
+  if (this->_internal_failed() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(6, this->_internal_failed(), target);
+  }
+
+  // string error_text = 7;
+  if (!this->_internal_error_text().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_error_text().data(), static_cast<int>(this->_internal_error_text().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "toyBasket.RpcMeta.error_text");
+    target = stream->WriteStringMaybeAliased(
+        7, this->_internal_error_text(), target);
+  }
+
+  // uint32 method_id = 8;
+  if (this->_internal_method_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(8, this->_internal_method_id(), target);
+  }
+
+  // uint32 features = 9;
+  if (this->_internal_features() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(9, this->_internal_features(), target);
+  }
+
+  // bool compressed = 10;
+  if (this->_internal_compressed() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(10, this->_internal_compressed(), target);
+  }
+
+  // uint32 stream = 11;
+  if (this->_internal_stream() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(11, this->_internal_stream(), target);
+  }
+
+  // uint32 credit = 12;
+  if (this->_internal_credit() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(12, this->_internal_credit(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:toyBasket.RpcMeta)
+  return target;
 }
 
-void RpcMeta::MergeFrom(const RpcMeta& from)
-{
-    // @@protoc_insertion_point(class_specific_merge_from_start:toyBasket.RpcMeta)
-    GOOGLE_DCHECK_NE(&from, this);
-    _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-    ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-    (void)cached_has_bits;
-
-    if (from.server().size() > 0)
-    {
-        _internal_set_server(from._internal_server());
-    }
-    if (from.method().size() > 0)
-    {
-        _internal_set_method(from._internal_method());
-    }
-    if (from.id() != 0)
-    {
-        _internal_set_id(from._internal_id());
-    }
-    if (from.data_size() != 0)
-    {
-        _internal_set_data_size(from._internal_data_size());
-    }
+size_t RpcMeta::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:toyBasket.RpcMeta)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string server = 2;
+  if (!this->_internal_server().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_server());
+  }
+
+  // string method = 3;
+  if (!this->_internal_method().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_method());
+  }
+
+  // string error_text = 7;
+  if (!this->_internal_error_text().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_error_text());
+  }
+
+  // fixed64 id = 1;
+  if (this->_internal_id() != 0) {
+    total_size += 1 + 8;
+  }
+
+  // int32 data_size = 4;
+  if (this->_internal_data_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_data_size());
+  }
+
+  // uint32 timeout_ms = 5;
+  if (this->_internal_timeout_ms() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_timeout_ms());
+  }
+
+  // uint32 method_id = 8;
+  if (this->_internal_method_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_method_id());
+  }
+
+  // bool failed = 6;
+  if (this->_internal_failed() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool compressed = 10;
+  if (this->_internal_compressed() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // uint32 features = 9;
+  if (this->_internal_features() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_features());
+  }
+
+  // uint32 stream = 11;
+  if (this->_internal_stream() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_stream());
+  }
+
+  // uint32 credit = 12;
+  if (this->_internal_credit() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_credit());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void RpcMeta::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from)
-{
-    // @@protoc_insertion_point(generalized_copy_from_start:toyBasket.RpcMeta)
-    if (&from == this)
-        return;
-    Clear();
-    MergeFrom(from);
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RpcMeta::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RpcMeta::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RpcMeta::GetClassData() const { return &_class_data_; }
+
+
+void RpcMeta::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RpcMeta*>(&to_msg);
+  auto& from = static_cast<const RpcMeta&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:toyBasket.RpcMeta)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_server().empty()) {
+    _this->_internal_set_server(from._internal_server());
+  }
+  if (!from._internal_method().empty()) {
+    _this->_internal_set_method(from._internal_method());
+  }
+  if (!from._internal_error_text().empty()) {
+    _this->_internal_set_error_text(from._internal_error_text());
+  }
+  if (from._internal_id() != 0) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  if (from._internal_data_size() != 0) {
+    _this->_internal_set_data_size(from._internal_data_size());
+  }
+  if (from._internal_timeout_ms() != 0) {
+    _this->_internal_set_timeout_ms(from._internal_timeout_ms());
+  }
+  if (from._internal_method_id() != 0) {
+    _this->_internal_set_method_id(from._internal_method_id());
+  }
+  if (from._internal_failed() != 0) {
+    _this->_internal_set_failed(from._internal_failed());
+  }
+  if (from._internal_compressed() != 0) {
+    _this->_internal_set_compressed(from._internal_compressed());
+  }
+  if (from._internal_features() != 0) {
+    _this->_internal_set_features(from._internal_features());
+  }
+  if (from._internal_stream() != 0) {
+    _this->_internal_set_stream(from._internal_stream());
+  }
+  if (from._internal_credit() != 0) {
+    _this->_internal_set_credit(from._internal_credit());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void RpcMeta::CopyFrom(const RpcMeta& from)
-{
-    // @@protoc_insertion_point(class_specific_copy_from_start:toyBasket.RpcMeta)
-    if (&from == this)
-        return;
-    Clear();
-    MergeFrom(from);
+void RpcMeta::CopyFrom(const RpcMeta& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:toyBasket.RpcMeta)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
 }
 
-bool RpcMeta::IsInitialized() const
-{
-    return true;
+bool RpcMeta::IsInitialized() const {
+  return true;
 }
 
-void RpcMeta::InternalSwap(RpcMeta* other)
-{
-    using std::swap;
-    _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-    server_.Swap(&other->server_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-    method_.Swap(&other->method_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-    ::PROTOBUF_NAMESPACE_ID::internal::memswap<PROTOBUF_FIELD_OFFSET(RpcMeta, data_size_) + sizeof(RpcMeta::data_size_)
-                                               - PROTOBUF_FIELD_OFFSET(RpcMeta, id_)>(
-        reinterpret_cast<char*>(&id_), reinterpret_cast<char*>(&other->id_));
+void RpcMeta::InternalSwap(RpcMeta* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.server_, lhs_arena,
+      &other->_impl_.server_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.method_, lhs_arena,
+      &other->_impl_.method_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.error_text_, lhs_arena,
+      &other->_impl_.error_text_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RpcMeta, _impl_.credit_)
+      + sizeof(RpcMeta::_impl_.credit_)
+      - PROTOBUF_FIELD_OFFSET(RpcMeta, _impl_.id_)>(
+          reinterpret_cast<char*>(&_impl_.id_),
+          reinterpret_cast<char*>(&other->_impl_.id_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata RpcMeta::GetMetadata() const
-{
-    return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata RpcMeta::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_rpc_5fmeta_2eproto_getter, &descriptor_table_rpc_5fmeta_2eproto_once,
+      file_level_metadata_rpc_5fmeta_2eproto[0]);
 }
 
 // @@protoc_insertion_point(namespace_scope)
-} // namespace toyBasket
+}  // namespace toyBasket
 PROTOBUF_NAMESPACE_OPEN
-template <>
-PROTOBUF_NOINLINE ::toyBasket::RpcMeta* Arena::CreateMaybeMessage<::toyBasket::RpcMeta>(Arena* arena)
-{
-    return Arena::CreateMessageInternal<::toyBasket::RpcMeta>(arena);
+template<> PROTOBUF_NOINLINE ::toyBasket::RpcMeta*
+Arena::CreateMaybeMessage< ::toyBasket::RpcMeta >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::toyBasket::RpcMeta >(arena);
 }
 PROTOBUF_NAMESPACE_CLOSE
 
@@ -8,12 +8,12 @@
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3013000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3013000 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -23,478 +23,671 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/inlined_string_field.h>
 #include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
-#include <google/protobuf/repeated_field.h> // IWYU pragma: export
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
 #include <google/protobuf/extension_set.h>  // IWYU pragma: export
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
 #include <google/protobuf/port_def.inc>
 #define PROTOBUF_INTERNAL_EXPORT_rpc_5fmeta_2eproto
 PROTOBUF_NAMESPACE_OPEN
-namespace internal
-{
+namespace internal {
 class AnyMetadata;
-} // namespace internal
+}  // namespace internal
 PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
-struct TableStruct_rpc_5fmeta_2eproto
-{
-    static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[] PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-    static const ::PROTOBUF_NAMESPACE_ID::internal::AuxiliaryParseTableField
-        aux[] PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-    static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[1] PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-    static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
-    static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
-    static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+struct TableStruct_rpc_5fmeta_2eproto {
+  static const uint32_t offsets[];
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_rpc_5fmeta_2eproto;
-namespace toyBasket
-{
+namespace toyBasket {
 class RpcMeta;
-class RpcMetaDefaultTypeInternal;
+struct RpcMetaDefaultTypeInternal;
 extern RpcMetaDefaultTypeInternal _RpcMeta_default_instance_;
-} // namespace toyBasket
+}  // namespace toyBasket
 PROTOBUF_NAMESPACE_OPEN
-template <>
-::toyBasket::RpcMeta* Arena::CreateMaybeMessage<::toyBasket::RpcMeta>(Arena*);
+template<> ::toyBasket::RpcMeta* Arena::CreateMaybeMessage<::toyBasket::RpcMeta>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
-namespace toyBasket
-{
+namespace toyBasket {
 
 // ===================================================================
 
-class RpcMeta PROTOBUF_FINAL
-    : public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:toyBasket.RpcMeta) */
-{
-public:
-    inline RpcMeta()
-        : RpcMeta(nullptr)
-    {
+class RpcMeta final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:toyBasket.RpcMeta) */ {
+ public:
+  inline RpcMeta() : RpcMeta(nullptr) {}
+  ~RpcMeta() override;
+  explicit PROTOBUF_CONSTEXPR RpcMeta(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RpcMeta(const RpcMeta& from);
+  RpcMeta(RpcMeta&& from) noexcept
+    : RpcMeta() {
+    *this = ::std::move(from);
+  }
+
+  inline RpcMeta& operator=(const RpcMeta& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RpcMeta& operator=(RpcMeta&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
     }
-    virtual ~RpcMeta();
-
-    RpcMeta(const RpcMeta& from);
-    RpcMeta(RpcMeta&& from) noexcept
-        : RpcMeta()
-    {
-        *this = ::std::move(from);
-    }
-
-    inline RpcMeta& operator=(const RpcMeta& from)
-    {
-        CopyFrom(from);
-        return *this;
-    }
-    inline RpcMeta& operator=(RpcMeta&& from) noexcept
-    {
-        if (GetArena() == from.GetArena())
-        {
-            if (this != &from)
-                InternalSwap(&from);
-        }
-        else
-        {
-            CopyFrom(from);
-        }
-        return *this;
-    }
-
-    static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor()
-    {
-        return GetDescriptor();
-    }
-    static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor()
-    {
-        return GetMetadataStatic().descriptor;
-    }
-    static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection()
-    {
-        return GetMetadataStatic().reflection;
-    }
-    static const RpcMeta& default_instance();
-
-    static void InitAsDefaultInstance(); // FOR INTERNAL USE ONLY
-    static inline const RpcMeta* internal_default_instance()
-    {
-        return reinterpret_cast<const RpcMeta*>(&_RpcMeta_default_instance_);
-    }
-    static constexpr int kIndexInFileMessages = 0;
-
-    friend void swap(RpcMeta& a, RpcMeta& b)
-    {
-        a.Swap(&b);
-    }
-    inline void Swap(RpcMeta* other)
-    {
-        if (other == this)
-            return;
-        if (GetArena() == other->GetArena())
-        {
-            InternalSwap(other);
-        }
-        else
-        {
-            ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
-        }
-    }
-    void UnsafeArenaSwap(RpcMeta* other)
-    {
-        if (other == this)
-            return;
-        GOOGLE_DCHECK(GetArena() == other->GetArena());
-        InternalSwap(other);
-    }
-
-    // implements Message ----------------------------------------------
-
-    inline RpcMeta* New() const final
-    {
-        return CreateMaybeMessage<RpcMeta>(nullptr);
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RpcMeta& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RpcMeta* internal_default_instance() {
+    return reinterpret_cast<const RpcMeta*>(
+               &_RpcMeta_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(RpcMeta& a, RpcMeta& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RpcMeta* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
-
-    RpcMeta* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final
-    {
-        return CreateMaybeMessage<RpcMeta>(arena);
-    }
-    void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-    void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-    void CopyFrom(const RpcMeta& from);
-    void MergeFrom(const RpcMeta& from);
-    PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
-    bool IsInitialized() const final;
-
-    size_t ByteSizeLong() const final;
-    const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-    ::PROTOBUF_NAMESPACE_ID::uint8*
-    _InternalSerialize(::PROTOBUF_NAMESPACE_ID::uint8* target,
-                       ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-    int GetCachedSize() const final
-    {
-        return _cached_size_.Get();
-    }
-
-private:
-    inline void SharedCtor();
-    inline void SharedDtor();
-    void SetCachedSize(int size) const final;
-    void InternalSwap(RpcMeta* other);
-    friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
-    static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName()
-    {
-        return "toyBasket.RpcMeta";
-    }
-
-protected:
-    explicit RpcMeta(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-
-private:
-    static void ArenaDtor(void* object);
-    inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-
-public:
-    ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-
-private:
-    static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic()
-    {
-        ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_rpc_5fmeta_2eproto);
-        return ::descriptor_table_rpc_5fmeta_2eproto.file_level_metadata[kIndexInFileMessages];
-    }
-
-public:
-    // nested types ----------------------------------------------------
-
-    // accessors -------------------------------------------------------
-
-    enum : int
-    {
-        kServerFieldNumber   = 2,
-        kMethodFieldNumber   = 3,
-        kIdFieldNumber       = 1,
-        kDataSizeFieldNumber = 4,
-    };
-    // string server = 2;
-    void clear_server();
-    const std::string& server() const;
-    void set_server(const std::string& value);
-    void set_server(std::string&& value);
-    void set_server(const char* value);
-    void set_server(const char* value, size_t size);
-    std::string* mutable_server();
-    std::string* release_server();
-    void set_allocated_server(std::string* server);
-
-private:
-    const std::string& _internal_server() const;
-    void _internal_set_server(const std::string& value);
-    std::string* _internal_mutable_server();
-
-public:
-    // string method = 3;
-    void clear_method();
-    const std::string& method() const;
-    void set_method(const std::string& value);
-    void set_method(std::string&& value);
-    void set_method(const char* value);
-    void set_method(const char* value, size_t size);
-    std::string* mutable_method();
-    std::string* release_method();
-    void set_allocated_method(std::string* method);
-
-private:
-    const std::string& _internal_method() const;
-    void _internal_set_method(const std::string& value);
-    std::string* _internal_mutable_method();
-
-public:
-    // fixed64 id = 1;
-    void clear_id();
-    ::PROTOBUF_NAMESPACE_ID::uint64 id() const;
-    void set_id(::PROTOBUF_NAMESPACE_ID::uint64 value);
-
-private:
-    ::PROTOBUF_NAMESPACE_ID::uint64 _internal_id() const;
-    void _internal_set_id(::PROTOBUF_NAMESPACE_ID::uint64 value);
-
-public:
-    // int32 data_size = 4;
-    void clear_data_size();
-    ::PROTOBUF_NAMESPACE_ID::int32 data_size() const;
-    void set_data_size(::PROTOBUF_NAMESPACE_ID::int32 value);
-
-private:
-    ::PROTOBUF_NAMESPACE_ID::int32 _internal_data_size() const;
-    void _internal_set_data_size(::PROTOBUF_NAMESPACE_ID::int32 value);
-
-public:
-    // @@protoc_insertion_point(class_scope:toyBasket.RpcMeta)
-private:
-    class _Internal;
-
-    template <typename T>
-    friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
-    typedef void InternalArenaConstructable_;
-    typedef void DestructorSkippable_;
+  }
+  void UnsafeArenaSwap(RpcMeta* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RpcMeta* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RpcMeta>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RpcMeta& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RpcMeta& from) {
+    RpcMeta::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RpcMeta* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "toyBasket.RpcMeta";
+  }
+  protected:
+  explicit RpcMeta(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kServerFieldNumber = 2,
+    kMethodFieldNumber = 3,
+    kErrorTextFieldNumber = 7,
+    kIdFieldNumber = 1,
+    kDataSizeFieldNumber = 4,
+    kTimeoutMsFieldNumber = 5,
+    kMethodIdFieldNumber = 8,
+    kFailedFieldNumber = 6,
+    kCompressedFieldNumber = 10,
+    kFeaturesFieldNumber = 9,
+    kStreamFieldNumber = 11,
+    kCreditFieldNumber = 12,
+  };
+  // string server = 2;
+  void clear_server();
+  const std::string& server() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_server(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_server();
+  PROTOBUF_NODISCARD std::string* release_server();
+  void set_allocated_server(std::string* server);
+  private:
+  const std::string& _internal_server() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_server(const std::string& value);
+  std::string* _internal_mutable_server();
+  public:
+
+  // string method = 3;
+  void clear_method();
+  const std::string& method() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_method(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_method();
+  PROTOBUF_NODISCARD std::string* release_method();
+  void set_allocated_method(std::string* method);
+  private:
+  const std::string& _internal_method() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_method(const std::string& value);
+  std::string* _internal_mutable_method();
+  public:
+
+  // string error_text = 7;
+  void clear_error_text();
+  const std::string& error_text() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error_text(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error_text();
+  PROTOBUF_NODISCARD std::string* release_error_text();
+  void set_allocated_error_text(std::string* error_text);
+  private:
+  const std::string& _internal_error_text() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error_text(const std::string& value);
+  std::string* _internal_mutable_error_text();
+  public:
+
+  // fixed64 id = 1;
+  void clear_id();
+  uint64_t id() const;
+  void set_id(uint64_t value);
+  private:
+  uint64_t _internal_id() const;
+  void _internal_set_id(uint64_t value);
+  public:
+
+  // int32 data_size = 4;
+  void clear_data_size();
+  int32_t data_size() const;
+  void set_data_size(int32_t value);
+  private:
+  int32_t _internal_data_size() const;
+  void _internal_set_data_size(int32_t value);
+  public:
+
+  // uint32 timeout_ms = 5;
+  void clear_timeout_ms();
+  uint32_t timeout_ms() const;
+  void set_timeout_ms(uint32_t value);
+  private:
+  uint32_t _internal_timeout_ms() const;
+  void _internal_set_timeout_ms(uint32_t value);
+  public:
+
+  // uint32 method_id = 8;
+  void clear_method_id();
+  uint32_t method_id() const;
+  void set_method_id(uint32_t value);
+  private:
+  uint32_t _internal_method_id() const;
+  void _internal_set_method_id(uint32_t value);
+  public:
+
+  // bool failed = 6;
+  void clear_failed();
+  bool failed() const;
+  void set_failed(bool value);
+  private:
+  bool _internal_failed() const;
+  void _internal_set_failed(bool value);
+  public:
+
+  // bool compressed = 10;
+  void clear_compressed();
+  bool compressed() const;
+  void set_compressed(bool value);
+  private:
+  bool _internal_compressed() const;
+  void _internal_set_compressed(bool value);
+  public:
+
+  // uint32 features = 9;
+  void clear_features();
+  uint32_t features() const;
+  void set_features(uint32_t value);
+  private:
+  uint32_t _internal_features() const;
+  void _internal_set_features(uint32_t value);
+  public:
+
+  // uint32 stream = 11;
+  void clear_stream();
+  uint32_t stream() const;
+  void set_stream(uint32_t value);
+  private:
+  uint32_t _internal_stream() const;
+  void _internal_set_stream(uint32_t value);
+  public:
+
+  // uint32 credit = 12;
+  void clear_credit();
+  uint32_t credit() const;
+  void set_credit(uint32_t value);
+  private:
+  uint32_t _internal_credit() const;
+  void _internal_set_credit(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:toyBasket.RpcMeta)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr server_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr method_;
-    ::PROTOBUF_NAMESPACE_ID::uint64 id_;
-    ::PROTOBUF_NAMESPACE_ID::int32 data_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_text_;
+    uint64_t id_;
+    int32_t data_size_;
+    uint32_t timeout_ms_;
+    uint32_t method_id_;
+    bool failed_;
+    bool compressed_;
+    uint32_t features_;
+    uint32_t stream_;
+    uint32_t credit_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-    friend struct ::TableStruct_rpc_5fmeta_2eproto;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_rpc_5fmeta_2eproto;
 };
 // ===================================================================
 
+
 // ===================================================================
 
 #ifdef __GNUC__
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif // __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
 // RpcMeta
 
 // fixed64 id = 1;
-inline void RpcMeta::clear_id()
-{
-    id_ = PROTOBUF_ULONGLONG(0);
+inline void RpcMeta::clear_id() {
+  _impl_.id_ = uint64_t{0u};
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 RpcMeta::_internal_id() const
-{
-    return id_;
+inline uint64_t RpcMeta::_internal_id() const {
+  return _impl_.id_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 RpcMeta::id() const
-{
-    // @@protoc_insertion_point(field_get:toyBasket.RpcMeta.id)
-    return _internal_id();
+inline uint64_t RpcMeta::id() const {
+  // @@protoc_insertion_point(field_get:toyBasket.RpcMeta.id)
+  return _internal_id();
 }
-inline void RpcMeta::_internal_set_id(::PROTOBUF_NAMESPACE_ID::uint64 value)
-{
-
-    id_ = value;
+inline void RpcMeta::_internal_set_id(uint64_t value) {
+  
+  _impl_.id_ = value;
 }
-inline void RpcMeta::set_id(::PROTOBUF_NAMESPACE_ID::uint64 value)
-{
-    _internal_set_id(value);
-    // @@protoc_insertion_point(field_set:toyBasket.RpcMeta.id)
+inline void RpcMeta::set_id(uint64_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:toyBasket.RpcMeta.id)
 }
 
 // string server = 2;
-inline void RpcMeta::clear_server()
-{
-    server_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline void RpcMeta::clear_server() {
+  _impl_.server_.ClearToEmpty();
+}
+inline const std::string& RpcMeta::server() const {
+  // @@protoc_insertion_point(field_get:toyBasket.RpcMeta.server)
+  return _internal_server();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RpcMeta::set_server(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.server_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:toyBasket.RpcMeta.server)
+}
+inline std::string* RpcMeta::mutable_server() {
+  std::string* _s = _internal_mutable_server();
+  // @@protoc_insertion_point(field_mutable:toyBasket.RpcMeta.server)
+  return _s;
+}
+inline const std::string& RpcMeta::_internal_server() const {
+  return _impl_.server_.Get();
+}
+inline void RpcMeta::_internal_set_server(const std::string& value) {
+  
+  _impl_.server_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RpcMeta::_internal_mutable_server() {
+  
+  return _impl_.server_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RpcMeta::release_server() {
+  // @@protoc_insertion_point(field_release:toyBasket.RpcMeta.server)
+  return _impl_.server_.Release();
+}
+inline void RpcMeta::set_allocated_server(std::string* server) {
+  if (server != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.server_.SetAllocated(server, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.server_.IsDefault()) {
+    _impl_.server_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:toyBasket.RpcMeta.server)
 }
-inline const std::string& RpcMeta::server() const
-{
-    // @@protoc_insertion_point(field_get:toyBasket.RpcMeta.server)
-    return _internal_server();
+
+// string method = 3;
+inline void RpcMeta::clear_method() {
+  _impl_.method_.ClearToEmpty();
+}
+inline const std::string& RpcMeta::method() const {
+  // @@protoc_insertion_point(field_get:toyBasket.RpcMeta.method)
+  return _internal_method();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RpcMeta::set_method(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.method_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:toyBasket.RpcMeta.method)
+}
+inline std::string* RpcMeta::mutable_method() {
+  std::string* _s = _internal_mutable_method();
+  // @@protoc_insertion_point(field_mutable:toyBasket.RpcMeta.method)
+  return _s;
+}
+inline const std::string& RpcMeta::_internal_method() const {
+  return _impl_.method_.Get();
+}
+inline void RpcMeta::_internal_set_method(const std::string& value) {
+  
+  _impl_.method_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RpcMeta::_internal_mutable_method() {
+  
+  return _impl_.method_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RpcMeta::release_method() {
+  // @@protoc_insertion_point(field_release:toyBasket.RpcMeta.method)
+  return _impl_.method_.Release();
+}
+inline void RpcMeta::set_allocated_method(std::string* method) {
+  if (method != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.method_.SetAllocated(method, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.method_.IsDefault()) {
+    _impl_.method_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:toyBasket.RpcMeta.method)
 }
-inline void RpcMeta::set_server(const std::string& value)
-{
-    _internal_set_server(value);
-    // @@protoc_insertion_point(field_set:toyBasket.RpcMeta.server)
+
+// int32 data_size = 4;
+inline void RpcMeta::clear_data_size() {
+  _impl_.data_size_ = 0;
 }
-inline std::string* RpcMeta::mutable_server()
-{
-    // @@protoc_insertion_point(field_mutable:toyBasket.RpcMeta.server)
-    return _internal_mutable_server();
+inline int32_t RpcMeta::_internal_data_size() const {
+  return _impl_.data_size_;
 }
-inline const std::string& RpcMeta::_internal_server() const
-{
-    return server_.Get();
+inline int32_t RpcMeta::data_size() const {
+  // @@protoc_insertion_point(field_get:toyBasket.RpcMeta.data_size)
+  return _internal_data_size();
 }
-inline void RpcMeta::_internal_set_server(const std::string& value)
-{
-
-    server_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+inline void RpcMeta::_internal_set_data_size(int32_t value) {
+  
+  _impl_.data_size_ = value;
 }
-inline void RpcMeta::set_server(std::string&& value)
-{
-
-    server_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-    // @@protoc_insertion_point(field_set_rvalue:toyBasket.RpcMeta.server)
+inline void RpcMeta::set_data_size(int32_t value) {
+  _internal_set_data_size(value);
+  // @@protoc_insertion_point(field_set:toyBasket.RpcMeta.data_size)
 }
-inline void RpcMeta::set_server(const char* value)
-{
-    GOOGLE_DCHECK(value != nullptr);
 
-    server_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value), GetArena());
-    // @@protoc_insertion_point(field_set_char:toyBasket.RpcMeta.server)
+// uint32 timeout_ms = 5;
+inline void RpcMeta::clear_timeout_ms() {
+  _impl_.timeout_ms_ = 0u;
 }
-inline void RpcMeta::set_server(const char* value, size_t size)
-{
-
-    server_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-                ::std::string(reinterpret_cast<const char*>(value), size), GetArena());
-    // @@protoc_insertion_point(field_set_pointer:toyBasket.RpcMeta.server)
+inline uint32_t RpcMeta::_internal_timeout_ms() const {
+  return _impl_.timeout_ms_;
 }
-inline std::string* RpcMeta::_internal_mutable_server()
-{
-
-    return server_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline uint32_t RpcMeta::timeout_ms() const {
+  // @@protoc_insertion_point(field_get:toyBasket.RpcMeta.timeout_ms)
+  return _internal_timeout_ms();
 }
-inline std::string* RpcMeta::release_server()
-{
-    // @@protoc_insertion_point(field_release:toyBasket.RpcMeta.server)
-    return server_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline void RpcMeta::_internal_set_timeout_ms(uint32_t value) {
+  
+  _impl_.timeout_ms_ = value;
 }
-inline void RpcMeta::set_allocated_server(std::string* server)
-{
-    if (server != nullptr) { }
-    else
-    {
-    }
-    server_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), server, GetArena());
-    // @@protoc_insertion_point(field_set_allocated:toyBasket.RpcMeta.server)
+inline void RpcMeta::set_timeout_ms(uint32_t value) {
+  _internal_set_timeout_ms(value);
+  // @@protoc_insertion_point(field_set:toyBasket.RpcMeta.timeout_ms)
 }
 
-// string method = 3;
-inline void RpcMeta::clear_method()
-{
-    method_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// bool failed = 6;
+inline void RpcMeta::clear_failed() {
+  _impl_.failed_ = false;
 }
-inline const std::string& RpcMeta::method() const
-{
-    // @@protoc_insertion_point(field_get:toyBasket.RpcMeta.method)
-    return _internal_method();
+inline bool RpcMeta::_internal_failed() const {
+  return _impl_.failed_;
 }
-inline void RpcMeta::set_method(const std::string& value)
-{
-    _internal_set_method(value);
-    // @@protoc_insertion_point(field_set:toyBasket.RpcMeta.method)
+inline bool RpcMeta::failed() const {
+  // @@protoc_insertion_point(field_get:toyBasket.RpcMeta.failed)
+  return _internal_failed();
 }
-inline std::string* RpcMeta::mutable_method()
-{
-    // @@protoc_insertion_point(field_mutable:toyBasket.RpcMeta.method)
-    return _internal_mutable_method();
+inline void RpcMeta::_internal_set_failed(bool value) {
+  
+  _impl_.failed_ = value;
 }
-inline const std::string& RpcMeta::_internal_method() const
-{
-    return method_.Get();
+inline void RpcMeta::set_failed(bool value) {
+  _internal_set_failed(value);
+  // @@protoc_insertion_point(field_set:toyBasket.RpcMeta.failed)
 }
-inline void RpcMeta::_internal_set_method(const std::string& value)
-{
 
-    method_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+// string error_text = 7;
+inline void RpcMeta::clear_error_text() {
+  _impl_.error_text_.ClearToEmpty();
 }
-inline void RpcMeta::set_method(std::string&& value)
-{
-
-    method_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-    // @@protoc_insertion_point(field_set_rvalue:toyBasket.RpcMeta.method)
+inline const std::string& RpcMeta::error_text() const {
+  // @@protoc_insertion_point(field_get:toyBasket.RpcMeta.error_text)
+  return _internal_error_text();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RpcMeta::set_error_text(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.error_text_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:toyBasket.RpcMeta.error_text)
+}
+inline std::string* RpcMeta::mutable_error_text() {
+  std::string* _s = _internal_mutable_error_text();
+  // @@protoc_insertion_point(field_mutable:toyBasket.RpcMeta.error_text)
+  return _s;
+}
+inline const std::string& RpcMeta::_internal_error_text() const {
+  return _impl_.error_text_.Get();
+}
+inline void RpcMeta::_internal_set_error_text(const std::string& value) {
+  
+  _impl_.error_text_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RpcMeta::_internal_mutable_error_text() {
+  
+  return _impl_.error_text_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RpcMeta::release_error_text() {
+  // @@protoc_insertion_point(field_release:toyBasket.RpcMeta.error_text)
+  return _impl_.error_text_.Release();
+}
+inline void RpcMeta::set_allocated_error_text(std::string* error_text) {
+  if (error_text != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.error_text_.SetAllocated(error_text, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_text_.IsDefault()) {
+    _impl_.error_text_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:toyBasket.RpcMeta.error_text)
 }
-inline void RpcMeta::set_method(const char* value)
-{
-    GOOGLE_DCHECK(value != nullptr);
 
-    method_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value), GetArena());
-    // @@protoc_insertion_point(field_set_char:toyBasket.RpcMeta.method)
+// uint32 method_id = 8;
+inline void RpcMeta::clear_method_id() {
+  _impl_.method_id_ = 0u;
+}
+inline uint32_t RpcMeta::_internal_method_id() const {
+  return _impl_.method_id_;
+}
+inline uint32_t RpcMeta::method_id() const {
+  // @@protoc_insertion_point(field_get:toyBasket.RpcMeta.method_id)
+  return _internal_method_id();
+}
+inline void RpcMeta::_internal_set_method_id(uint32_t value) {
+  
+  _impl_.method_id_ = value;
+}
+inline void RpcMeta::set_method_id(uint32_t value) {
+  _internal_set_method_id(value);
+  // @@protoc_insertion_point(field_set:toyBasket.RpcMeta.method_id)
 }
-inline void RpcMeta::set_method(const char* value, size_t size)
-{
 
-    method_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-                ::std::string(reinterpret_cast<const char*>(value), size), GetArena());
-    // @@protoc_insertion_point(field_set_pointer:toyBasket.RpcMeta.method)
+// uint32 features = 9;
+inline void RpcMeta::clear_features() {
+  _impl_.features_ = 0u;
+}
+inline uint32_t RpcMeta::_internal_features() const {
+  return _impl_.features_;
+}
+inline uint32_t RpcMeta::features() const {
+  // @@protoc_insertion_point(field_get:toyBasket.RpcMeta.features)
+  return _internal_features();
+}
+inline void RpcMeta::_internal_set_features(uint32_t value) {
+  
+  _impl_.features_ = value;
+}
+inline void RpcMeta::set_features(uint32_t value) {
+  _internal_set_features(value);
+  // @@protoc_insertion_point(field_set:toyBasket.RpcMeta.features)
 }
-inline std::string* RpcMeta::_internal_mutable_method()
-{
 
-    return method_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// bool compressed = 10;
+inline void RpcMeta::clear_compressed() {
+  _impl_.compressed_ = false;
 }
-inline std::string* RpcMeta::release_method()
-{
-    // @@protoc_insertion_point(field_release:toyBasket.RpcMeta.method)
-    return method_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline bool RpcMeta::_internal_compressed() const {
+  return _impl_.compressed_;
 }
-inline void RpcMeta::set_allocated_method(std::string* method)
-{
-    if (method != nullptr) { }
-    else
-    {
-    }
-    method_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), method, GetArena());
-    // @@protoc_insertion_point(field_set_allocated:toyBasket.RpcMeta.method)
+inline bool RpcMeta::compressed() const {
+  // @@protoc_insertion_point(field_get:toyBasket.RpcMeta.compressed)
+  return _internal_compressed();
+}
+inline void RpcMeta::_internal_set_compressed(bool value) {
+  
+  _impl_.compressed_ = value;
+}
+inline void RpcMeta::set_compressed(bool value) {
+  _internal_set_compressed(value);
+  // @@protoc_insertion_point(field_set:toyBasket.RpcMeta.compressed)
 }
 
-// int32 data_size = 4;
-inline void RpcMeta::clear_data_size()
-{
-    data_size_ = 0;
+// uint32 stream = 11;
+inline void RpcMeta::clear_stream() {
+  _impl_.stream_ = 0u;
+}
+inline uint32_t RpcMeta::_internal_stream() const {
+  return _impl_.stream_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RpcMeta::_internal_data_size() const
-{
-    return data_size_;
+inline uint32_t RpcMeta::stream() const {
+  // @@protoc_insertion_point(field_get:toyBasket.RpcMeta.stream)
+  return _internal_stream();
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RpcMeta::data_size() const
-{
-    // @@protoc_insertion_point(field_get:toyBasket.RpcMeta.data_size)
-    return _internal_data_size();
+inline void RpcMeta::_internal_set_stream(uint32_t value) {
+  
+  _impl_.stream_ = value;
+}
+inline void RpcMeta::set_stream(uint32_t value) {
+  _internal_set_stream(value);
+  // @@protoc_insertion_point(field_set:toyBasket.RpcMeta.stream)
 }
-inline void RpcMeta::_internal_set_data_size(::PROTOBUF_NAMESPACE_ID::int32 value)
-{
 
-    data_size_ = value;
+// uint32 credit = 12;
+inline void RpcMeta::clear_credit() {
+  _impl_.credit_ = 0u;
+}
+inline uint32_t RpcMeta::_internal_credit() const {
+  return _impl_.credit_;
+}
+inline uint32_t RpcMeta::credit() const {
+  // @@protoc_insertion_point(field_get:toyBasket.RpcMeta.credit)
+  return _internal_credit();
+}
+inline void RpcMeta::_internal_set_credit(uint32_t value) {
+  
+  _impl_.credit_ = value;
 }
-inline void RpcMeta::set_data_size(::PROTOBUF_NAMESPACE_ID::int32 value)
-{
-    _internal_set_data_size(value);
-    // @@protoc_insertion_point(field_set:toyBasket.RpcMeta.data_size)
+inline void RpcMeta::set_credit(uint32_t value) {
+  _internal_set_credit(value);
+  // @@protoc_insertion_point(field_set:toyBasket.RpcMeta.credit)
 }
 
 #ifdef __GNUC__
-#pragma GCC diagnostic pop
-#endif // __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
 
 // @@protoc_insertion_point(namespace_scope)
 
-} // namespace toyBasket
+}  // namespace toyBasket
 
 // @@protoc_insertion_point(global_scope)
 
 #include <google/protobuf/port_undef.inc>
-#endif // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_rpc_5fmeta_2eproto
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_rpc_5fmeta_2eproto
@@ -1,35 +1,134 @@
 #include "rpc_server.h"
+#include "rpc_codec.h"
 #include "rpc_meta.pb.h"
-#include <arpa/inet.h>
+#include "TaskThreadPool.h"
+#include "google/protobuf/empty.pb.h"
+#include <iterator>
+#include <limits>
 
 namespace toyBasket
 {
+const int RpcServer::kDefaultWorkerThreads;
+const size_t RpcServer::kArenaBlockSize;
+const size_t RpcServer::kMaxPooledCalls;
+
+static google::protobuf::ArenaOptions MakeArenaOptions(char* block, size_t size)
+{
+    google::protobuf::ArenaOptions options;
+    options.initial_block      = block;
+    options.initial_block_size = size;
+    return options;
+}
+
+RpcServer::PendingCall::PendingCall(RpcServer* server)
+    : server_(server)
+    , id_(0)
+    , request_(NULL)
+    , response_(NULL)
+    , method_id_(0)
+    , features_(0)
+    , fixed_header_(false)
+    , compress_threshold_(0)
+    , arena_(MakeArenaOptions(arena_block_, sizeof arena_block_))
+{
+}
+
+void RpcServer::PendingCall::Run()
+{
+    server_->OnCallbackDone(this);
+}
+
 RpcServer::RpcServer(EventLoop* loop, const InetAddress& listenAddr)
-    : server_(new StreamServer(loop, listenAddr, "RpcServer"))
+    : started_(false)
+    , codec_(std::bind(&RpcServer::onFrame, this, _1, _2), std::bind(&RpcServer::onHeaderFrame, this, _1, _2, _3))
+    , fixed_header_(true)
+    , compress_threshold_(0)
+    , write_coalescing_(true)
+    , server_(new StreamServer(loop, listenAddr, "RpcServer"))
+    , worker_threads_(kDefaultWorkerThreads)
 {
-    server_->setMessageCallback(std::bind(&RpcServer::onMessage, this, _1, _2));
+    server_->setMessageCallback(std::bind(&RpcCodec::onMessage, &codec_, _1, _2));
     server_->setConnectionCallback(std::bind(&RpcServer::onConnection, this, _1));
 }
 RpcServer::~RpcServer()
 {
+    // 先等工作线程上的调用结束, 它们还会归还上下文
+    // 之后 IO 线程收到的请求不再入队, 直接回复失败
+    if (shared_pool_)
+    {
+        shared_pool_->stop();
+    }
+    for (auto& pool : dedicated_pools_)
+    {
+        pool->stop();
+    }
+    // 再停掉 IO 线程和连接, 之后没有人再取用上下文
+    server_.reset();
+    for (PendingCall* call : free_calls_)
+    {
+        delete call;
+    }
 }
 
 bool RpcServer::Start()
 {
+    if (started_)
+    {
+        return false;
+    }
+    for (auto& it : services_)
+    {
+        ServiceInfo& service_info                              = it.second;
+        const google::protobuf::ServiceDescriptor* sdescriptor = service_info.service_->GetDescriptor();
+        for (int i = 0; i < sdescriptor->method_count(); ++i)
+        {
+            const google::protobuf::MethodDescriptor* mdescriptor = sdescriptor->method(i);
+            TaskThreadPool* executor                              = service_info.executor_[mdescriptor->name()];
+            std::map<std::string, size_t>::const_iterator threshold =
+                service_info.compress_threshold_.find(mdescriptor->name());
+            MethodInfo method_info = { service_info.service_, mdescriptor, executor,
+                                       threshold != service_info.compress_threshold_.end() ? threshold->second
+                                                                                            : compress_threshold_ };
+            methods_.push_back(method_info);
+            service_info.method_id_[mdescriptor->name()] = static_cast<uint32_t>(methods_.size());
+        }
+    }
+    started_ = true;
+
+    // 线程池先于 IO 启动, 只有用到共用线程池时才创建线程
+    if (shared_pool_)
+    {
+        shared_pool_->setThreadNum(worker_threads_);
+        shared_pool_->start();
+    }
+    for (auto& pool : dedicated_pools_)
+    {
+        pool->start();
+    }
+
     // basic server
     server_->start();
     return true;
 }
 
-bool RpcServer::RegisterService(google::protobuf::Service* service, bool ownership)
+bool RpcServer::RegisterService(google::protobuf::Service* service, bool ownership, ExecutorType executor,
+                                int num_threads)
 {
+    if (started_)
+    {
+        LOG_ERROR << "RpcServer: RegisterService after Start";
+        return false;
+    }
+
     ServiceInfo service_info;
     std::string method_id;
     const google::protobuf::ServiceDescriptor* sdescriptor = service->GetDescriptor();
+    TaskThreadPool* pool = MakeExecutor(executor, num_threads, sdescriptor->name());
     for (int i = 0; i < sdescriptor->method_count(); ++i)
     {
         method_id                            = sdescriptor->method(i)->name();
         service_info.mdescriptor_[method_id] = sdescriptor->method(i);
+        service_info.executor_[method_id]    = pool;
     }
 
     service_info.service_          = service;
@@ -37,78 +136,374 @@ bool RpcServer::RegisterService(google::protobuf::Service* service, bool ownersh
     return true;
 }
 
-void RpcServer::onMessage(const StreamConnectionPtr& conn, Buffer* buff)
+bool RpcServer::SetMethodExecutor(const std::string& service_name, const std::string& method_name,
+                                  ExecutorType executor, int num_threads)
 {
-    while (buff->readableBytes() > sizeof(int32_t))
+    if (started_)
     {
-        const int32_t len = buff->peekInt32();
-        if (buff->readableBytes() > (len + sizeof(int32_t)))
+        LOG_ERROR << "RpcServer: SetMethodExecutor after Start";
+        return false;
+    }
+
+    std::map<std::string, ServiceInfo>::iterator it = services_.find(service_name);
+    if (it == services_.end() || it->second.mdescriptor_.find(method_name) == it->second.mdescriptor_.end())
+    {
+        LOG_ERROR << "RpcServer: no such method " << service_name << "." << method_name;
+        return false;
+    }
+
+    it->second.executor_[method_name] = MakeExecutor(executor, num_threads, service_name + "." + method_name);
+    return true;
+}
+
+bool RpcServer::SetMethodCompressThreshold(const std::string& service_name, const std::string& method_name,
+                                           size_t threshold)
+{
+    if (started_)
+    {
+        LOG_ERROR << "RpcServer: SetMethodCompressThreshold after Start";
+        return false;
+    }
+
+    std::map<std::string, ServiceInfo>::iterator it = services_.find(service_name);
+    if (it == services_.end() || it->second.mdescriptor_.find(method_name) == it->second.mdescriptor_.end())
+    {
+        LOG_ERROR << "RpcServer: no such method " << service_name << "." << method_name;
+        return false;
+    }
+
+    it->second.compress_threshold_[method_name] = threshold;
+    return true;
+}
+
+TaskThreadPool* RpcServer::MakeExecutor(ExecutorType executor, int num_threads, const std::string& name)
+{
+    switch (executor)
+    {
+    case kSharedPool:
+        if (!shared_pool_)
         {
-            std::string meta_data(buff->peek() + sizeof(int32_t), len);
-            RpcMeta meta_proto;
-            meta_proto.ParseFromString(meta_data);
-            int length = sizeof(int32_t) + len + meta_proto.data_size();
-            if (buff->readableBytes() >= length)
-            {
-                ProcRpcData(meta_proto.id(), meta_proto.server(), meta_proto.method(),
-                            std::string(buff->peek() + len + sizeof(int32_t), meta_proto.data_size()));
-                buff->retrieve(length);
-                continue;
-            }
-            else
+            shared_pool_.reset(new TaskThreadPool("RpcWorker"));
+        }
+        return shared_pool_.get();
+    case kDedicatedPool:
+    {
+        TaskThreadPool* pool = new TaskThreadPool(name);
+        pool->setThreadNum(num_threads);
+        dedicated_pools_.push_back(std::unique_ptr<TaskThreadPool>(pool));
+        return pool;
+    }
+    default:
+        return NULL;
+    }
+}
+
+void RpcServer::onConnection(const StreamConnectionPtr& conn)
+{
+    if (conn->connected())
+    {
+        // 请求和响应都是小包, 关掉 Nagle 避免与延迟 ACK 叠加出 40ms 的等待
+        conn->setTcpNoDelay(true);
+        RpcStream::WatchHighWaterMark(conn, std::bind(&RpcServer::ConnectionStreams, this, conn.get(), false));
+        return;
+    }
+
+    // 连接断开后调用方收不到后续的消息, 流式调用按取消处理, 方法实现从 CloseCallback 或 IsCanceled 得知
+    for (auto& stream : ConnectionStreams(conn.get(), true))
+    {
+        stream->Abort();
+    }
+}
+
+std::vector<std::shared_ptr<RpcStream>> RpcServer::ConnectionStreams(const StreamConnection* conn, bool erase)
+{
+    std::vector<std::shared_ptr<RpcStream>> streams;
+    std::unique_lock<std::mutex> lock(streams_mutex_);
+    std::map<StreamKey, std::shared_ptr<RpcStream>>::iterator it =
+        streams_.lower_bound(StreamKey(conn, std::numeric_limits<int64_t>::min()));
+    while (it != streams_.end() && it->first.first == conn)
+    {
+        streams.push_back(it->second);
+        it = erase ? streams_.erase(it) : std::next(it);
+    }
+    return streams;
+}
+
+void RpcServer::onFrame(const StreamConnectionPtr& conn, const StringPiece& frame)
+{
+    RpcMeta meta_proto;
+    StringPiece payload;
+    if (!ParseRpcFrame(frame, &meta_proto, &payload))
+    {
+        LOG_ERROR << "RpcServer: bad frame from " << conn->name();
+        return;
+    }
+    if (meta_proto.stream() != 0)
+    {
+        onStreamFrame(conn, meta_proto, payload);
+        return;
+    }
+
+    // 调用方已经知道 id 时只发 id, 否则按名字查一次, 把 id 随响应带回
+    uint32_t method_id = meta_proto.method_id();
+    bool by_name       = false;
+    if (method_id == 0 || method_id > methods_.size())
+    {
+        method_id = FindMethodId(meta_proto.server(), meta_proto.method());
+        by_name   = true;
+    }
+    if (method_id == 0)
+    {
+        LOG_WARNING << "RpcServer: unknown method " << meta_proto.server() << "." << meta_proto.method() << " ("
+                    << meta_proto.method_id() << ") from " << conn->name();
+        SendError(conn, meta_proto.id(), false, "unknown method");
+        return;
+    }
+
+    // 收到的压缩请求总能解压, 只要调用方支持就同意压缩
+    const uint32_t supported =
+        fixed_header_ ? kRpcFeatureFixedHeader | kRpcFeatureCompression : kRpcFeatureCompression;
+    const bool accept_compressed = (meta_proto.features() & kRpcFeatureCompression) != 0;
+
+    PendingCall* call         = AcquireCall();
+    call->conn_               = conn;
+    call->id_                 = meta_proto.id();
+    call->method_id_          = by_name ? method_id : 0;
+    call->features_           = meta_proto.features() & supported;
+    call->fixed_header_       = false;
+    call->compress_threshold_ = accept_compressed ? methods_[method_id - 1].compress_threshold_ : 0;
+    ProcRpcData(call, method_id, meta_proto.timeout_ms(), payload, meta_proto.compressed());
+}
+
+void RpcServer::onHeaderFrame(const StreamConnectionPtr& conn, const RpcHeader& header, const StringPiece& payload)
+{
+    // 固定头帧只带 id, 调用方一定先通过 RpcMeta 学到了 id
+    const int64_t id = static_cast<int64_t>(header.id);
+    if (!fixed_header_ || header.method_id == 0 || header.method_id > methods_.size())
+    {
+        LOG_WARNING << "RpcServer: unknown method id " << header.method_id << " from " << conn->name();
+        SendError(conn, id, true, "unknown method");
+        return;
+    }
+
+    const bool accept_compressed = (header.flags & kRpcFlagAcceptCompressed) != 0;
+
+    PendingCall* call         = AcquireCall();
+    call->conn_               = conn;
+    call->id_                 = id;
+    call->method_id_          = 0;
+    call->features_           = 0;
+    call->fixed_header_       = true;
+    call->compress_threshold_ = accept_compressed ? methods_[header.method_id - 1].compress_threshold_ : 0;
+    ProcRpcData(call, header.method_id, (header.flags & kRpcFlagDeadline) ? header.timeout_ms : 0, payload,
+                (header.flags & kRpcFlagCompressed) != 0);
+}
+
+void RpcServer::onStreamFrame(const StreamConnectionPtr& conn, const RpcMeta& meta, const StringPiece& payload)
+{
+    std::shared_ptr<RpcStream> stream;
+    {
+        std::unique_lock<std::mutex> lock(streams_mutex_);
+        std::map<StreamKey, std::shared_ptr<RpcStream>>::iterator it =
+            streams_.find(StreamKey(conn.get(), static_cast<int64_t>(meta.id())));
+        if (it != streams_.end())
+        {
+            stream = it->second;
+        }
+    }
+    // 调用已经结束时迟到的帧直接丢弃
+    if (!stream)
+    {
+        return;
+    }
+
+    if (!stream->OnFrame(meta, payload))
+    {
+        LOG_WARNING << "RpcServer: unknown stream frame " << meta.stream() << " from " << conn->name();
+    }
+}
+
+uint32_t RpcServer::FindMethodId(const std::string& service_name, const std::string& method_name) const
+{
+    std::map<std::string, ServiceInfo>::const_iterator service = services_.find(service_name);
+    if (service == services_.end())
+    {
+        return 0;
+    }
+    std::map<std::string, uint32_t>::const_iterator method = service->second.method_id_.find(method_name);
+    return method == service->second.method_id_.end() ? 0 : method->second;
+}
+
+void RpcServer::ProcRpcData(PendingCall* call, uint32_t method_id, uint32_t timeout_ms,
+                            const StringPiece& serialzied_data, bool compressed)
+{
+    const MethodInfo& method_info = methods_[method_id - 1];
+    auto service                  = method_info.service_;
+    auto mdescriptor              = method_info.mdescriptor_;
+    auto executor                 = method_info.executor_;
+    auto recv_msg                 = service->GetRequestPrototype(mdescriptor).New(&call->arena_);
+    auto resp_msg                 = service->GetResponsePrototype(mdescriptor).New(&call->arena_);
+    if (!ParseRpcPayload(serialzied_data, compressed, recv_msg))
+    {
+        StreamConnectionPtr conn = call->conn_.lock();
+        LOG_WARNING << "RpcServer: bad request for " << mdescriptor->full_name() << " from " << conn->name();
+        SendError(conn, call->id_, call->fixed_header_, "bad request");
+        ReleaseCall(call);
+        return;
+    }
+
+    call->request_  = recv_msg;
+    call->response_ = resp_msg;
+    auto done       = call;
+    auto controller = &call->controller_;
+    if (timeout_ms > 0)
+    {
+        controller->SetDeadline(Clock::now() + std::chrono::milliseconds(timeout_ms));
+    }
+    if (mdescriptor->client_streaming() || mdescriptor->server_streaming())
+    {
+        // 先登记再执行, 调用方随后的消息按 id 找到这个流
+        StreamConnectionPtr conn          = call->conn_.lock();
+        std::shared_ptr<RpcStream> stream = controller->GetStream();
+        stream->Attach(conn, call->id_, &codec_.length_codec(), service->GetRequestPrototype(mdescriptor),
+                       call->compress_threshold_, write_coalescing_);
+        std::unique_lock<std::mutex> lock(streams_mutex_);
+        streams_[StreamKey(conn.get(), call->id_)] = stream;
+    }
+
+    if (executor)
+    {
+        // 慢方法不占用 IO 线程, 响应由 done 送回连接所在的 loop
+        // 在队列里等到调用方的截止时间之后的请求不再执行
+        bool queued = executor->run([=] {
+            if (controller->IsCanceled())
             {
-                break;
+                done->Run();
+                return;
             }
+            service->CallMethod(mdescriptor, controller, recv_msg, resp_msg, done);
+        });
+        if (!queued)
+        {
+            // 服务端正在析构, 线程池已停止
+            controller->SetFailed("server stopped");
+            done->Run();
+        }
+    }
+    else
+    {
+        service->CallMethod(mdescriptor, controller, recv_msg, resp_msg, done);
+    }
+}
+
+void RpcServer::OnCallbackDone(PendingCall* call)
+{
+    // 连接已断开, 或调用方已经超时不会再等这个响应, 都直接丢弃
+    StreamConnectionPtr conn          = call->conn_.lock();
+    std::shared_ptr<RpcStream> stream = call->controller_.stream_;
+    if (stream)
+    {
+        // 连接断开时已经移除
+        if (conn)
+        {
+            std::unique_lock<std::mutex> lock(streams_mutex_);
+            streams_.erase(StreamKey(conn.get(), call->id_));
+        }
+        stream->Finish();
+    }
+    if (!conn || call->controller_.IsCanceled())
+    {
+        ReleaseCall(call);
+        return;
+    }
+
+    std::string resp_data;
+    if (call->fixed_header_)
+    {
+        RpcHeader header = { 0, static_cast<uint64_t>(call->id_), 0, 0, 0 };
+        if (call->controller_.Failed())
+        {
+            SerializeRpcHeaderFrame(&header, call->controller_.ErrorText(), &resp_data);
         }
         else
         {
-            break;
+            SerializeRpcHeaderFrame(&header, *call->response_, &resp_data, call->compress_threshold_);
+        }
+    }
+    else
+    {
+        RpcMeta rpc_meta;
+        rpc_meta.set_id(call->id_);
+        rpc_meta.set_method_id(call->method_id_);
+        rpc_meta.set_features(call->features_);
+        if (call->controller_.Failed())
+        {
+            rpc_meta.set_failed(true);
+            rpc_meta.set_error_text(call->controller_.ErrorText());
         }
+        SerializeRpcFrame(codec_.length_codec(), &rpc_meta, *call->response_, &resp_data, call->compress_threshold_);
     }
+    // 响应已经序列化, 请求和响应可以随 arena 一起释放
+    const bool batched = write_coalescing_ && !call->controller_.ImmediateSend();
+    ReleaseCall(call);
+    // 线程安全, 非 IO 线程完成时会转到连接所在的 loop 发送; 合并时一轮 loop 的响应只唤醒一次, 只写一次
+    SendRpcFrame(conn, std::move(resp_data), batched);
 }
 
-void RpcServer::onConnection(const StreamConnectionPtr& conn)
+RpcServer::PendingCall* RpcServer::AcquireCall()
 {
-    if (conn->connected())
     {
-        basicConn_ = conn;
+        std::unique_lock<std::mutex> lock(pool_mutex_);
+        if (!free_calls_.empty())
+        {
+            PendingCall* call = free_calls_.back();
+            free_calls_.pop_back();
+            return call;
+        }
     }
+    return new PendingCall(this);
 }
 
-void RpcServer::ProcRpcData(const int64_t id, const std::string& service_id, const std::string& method_id,
-                            const std::string& serialzied_data)
+void RpcServer::ReleaseCall(PendingCall* call)
 {
-    auto service     = services_[service_id].service_;
-    auto mdescriptor = services_[service_id].mdescriptor_[method_id];
-    auto recv_msg    = service->GetRequestPrototype(mdescriptor).New();
-    auto resp_msg    = service->GetResponsePrototype(mdescriptor).New();
-    recv_msg->ParseFromString(serialzied_data);
-    auto done = google::protobuf::NewCallback(this, &RpcServer::OnCallbackDone, id, resp_msg);
+    // 复位在锁外做, 超出初始块的内存在这里还给系统
+    call->arena_.Reset();
+    call->controller_.Reset();
+    call->controller_.SetImmediateSend(false);
+    call->conn_.reset();
+    call->request_  = NULL;
+    call->response_ = NULL;
 
-    service->CallMethod(mdescriptor, NULL, recv_msg, resp_msg, done);
+    {
+        std::unique_lock<std::mutex> lock(pool_mutex_);
+        if (free_calls_.size() < kMaxPooledCalls)
+        {
+            free_calls_.push_back(call);
+            return;
+        }
+    }
+    delete call;
 }
 
-void RpcServer::OnCallbackDone(int64_t id, ::google::protobuf::Message* resp_msg)
-{
-    int serialized_size = resp_msg->ByteSize();
-    RpcMeta rpc_meta;
-    rpc_meta.set_id(id);
-    rpc_meta.set_data_size(serialized_size);
 
-    std::string rpc_meta_str;
-    rpc_meta.SerializeToString(&rpc_meta_str);
-    int32_t meta_size = htonl(rpc_meta_str.size());
+void RpcServer::SendError(const StreamConnectionPtr& conn, const int64_t id, bool fixed_header,
+                          const std::string& reason)
+{
     std::string resp_data;
-    resp_data.append(reinterpret_cast<const char*>(&meta_size), sizeof(int32_t));
-    resp_data += rpc_meta_str;
-    resp_msg->AppendToString(&resp_data);
-
-    // resp_msg->SerializeToString(&resp_data);
-    StreamConnectionPtr basicPtr = basicConn_.lock();
-    if (basicPtr)
+    if (fixed_header)
+    {
+        RpcHeader header = { 0, static_cast<uint64_t>(id), 0, 0, 0 };
+        SerializeRpcHeaderFrame(&header, reason, &resp_data);
+    }
+    else
     {
-        basicPtr->send(resp_data);
+        RpcMeta rpc_meta;
+        rpc_meta.set_id(id);
+        rpc_meta.set_failed(true);
+        rpc_meta.set_error_text(reason);
+        SerializeRpcFrame(codec_.length_codec(), &rpc_meta, google::protobuf::Empty(), &resp_data);
     }
+    SendRpcFrame(conn, std::move(resp_data), write_coalescing_);
 }
 
 } // namespace toyBasket
\ No newline at end of file
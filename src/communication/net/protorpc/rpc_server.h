@@ -1,37 +1,163 @@
 #ifndef _RPC_SERVER_H
 #define _RPC_SERVER_H
 
+#include <map>
+#include <mutex>
 #include <string>
 #include "StreamServer.h"
+#include "rpc_codec.h"
+#include "rpc_controller.h"
+#include "rpc_stream.h"
+#include "google/protobuf/arena.h"
 #include "google/protobuf/service.h"
 
 namespace toyBasket
 {
+class TaskThreadPool;
+
 class RpcServer
 {
 public:
+    // 方法的执行方式
+    enum ExecutorType
+    {
+        kInline,        // 在连接所在的 IO 线程直接执行
+        kSharedPool,    // 投递到所有服务共用的工作线程池
+        kDedicatedPool, // 投递到独占的工作线程池
+    };
+
+    static const int kDefaultWorkerThreads = 4;
+    // 每次调用的请求和响应先从调用上下文自带的这块内存里分配
+    static const size_t kArenaBlockSize = 2048;
+    // 最多缓存这么多个空闲的调用上下文
+    static const size_t kMaxPooledCalls = 1024;
+
     RpcServer(EventLoop* loop, const InetAddress& listenAddr);
     virtual ~RpcServer();
 
+    // 按服务名和方法名的顺序给所有方法分配 method_id, 建立分发表, 之后不能再注册或修改
     bool Start();
-    bool RegisterService(google::protobuf::Service* service, bool ownership);
+
+    // executor 是该服务所有方法的默认执行方式, kDedicatedPool 时 num_threads 为该服务独占的线程数
+    bool RegisterService(google::protobuf::Service* service, bool ownership, ExecutorType executor = kInline,
+                         int num_threads = 1);
+
+    // 单独指定某个方法的执行方式, 须在 RegisterService 之后, Start 之前调用
+    bool SetMethodExecutor(const std::string& service_name, const std::string& method_name, ExecutorType executor,
+                           int num_threads = 1);
+
+    // 共用线程池的线程数, 须在 Start 之前调用
+    void SetWorkerThreadNum(int num_threads)
+    {
+        worker_threads_ = num_threads;
+    }
+
+    // 处理连接读写的 IO 线程数, 0 表示都在 loop 所在的线程(默认); 须在 Start 之前调用
+    void SetIoThreadNum(int num_threads)
+    {
+        server_->setThreadNum(num_threads);
+    }
+
+    // 是否同意调用方切换到固定头帧, 默认同意; 关掉后所有连接都只用 RpcMeta
+    void SetFixedHeader(bool on)
+    {
+        fixed_header_ = on;
+    }
+
+    // 是否把同一轮 loop 里的响应合并成一次写, 默认合并; 单个调用可以用 RpcController::SetImmediateSend 立即发送
+    void SetWriteCoalescing(bool on)
+    {
+        write_coalescing_ = on;
+    }
+
+    // 序列化后不小于 threshold 字节的响应压缩发送, 0 表示不压缩(默认); 须在 Start 之前调用
+    // 只对表示可以接收压缩响应的调用方生效, 收到的压缩请求总是可以解压
+    void SetCompressThreshold(size_t threshold)
+    {
+        compress_threshold_ = threshold;
+    }
+
+    // 单个方法的阈值, 覆盖 SetCompressThreshold, 须在 RegisterService 之后, Start 之前调用
+    bool SetMethodCompressThreshold(const std::string& service_name, const std::string& method_name,
+                                    size_t threshold);
 
 private:
-    void onMessage(const StreamConnectionPtr& conn, Buffer* buff);
+    // 一次调用的上下文, 本身就是传给方法的 done, 执行时据此把响应写回发起请求的连接
+    // 请求和响应分配在 arena_ 上, 调用结束后整体复位, 上下文放回 free_calls_ 复用
+    struct PendingCall : public ::google::protobuf::Closure
+    {
+        explicit PendingCall(RpcServer* server);
+        void Run() override;
+
+        RpcServer* server_;
+        std::weak_ptr<StreamConnection> conn_;
+        int64_t id_;
+        ::google::protobuf::Message* request_;
+        ::google::protobuf::Message* response_;
+        RpcController controller_;  // 带着调用方的截止时间, 过期后 IsCanceled 返回 true
+        uint32_t method_id_;        // 请求按名字调用时随响应带回, 调用方之后只发 id
+        uint32_t features_;         // 随 RpcMeta 响应带回的特性
+        bool fixed_header_;         // 请求是固定头帧, 响应也用固定头帧
+        size_t compress_threshold_; // 调用方不接收压缩响应时为 0
+        alignas(8) char arena_block_[kArenaBlockSize];
+        ::google::protobuf::Arena arena_;
+    };
+
     void onConnection(const StreamConnectionPtr& conn);
-    void ProcRpcData(const int64_t id, const std::string& service_id, const std::string& method_id,
-                     const std::string& serialzied_data);
-    void OnCallbackDone(int64_t id, ::google::protobuf::Message* resp_msg);
+    void onFrame(const StreamConnectionPtr& conn, const StringPiece& frame);
+    void onHeaderFrame(const StreamConnectionPtr& conn, const RpcHeader& header, const StringPiece& payload);
+    // 流式调用开始后调用方发来的消息, 额度和结束/取消
+    void onStreamFrame(const StreamConnectionPtr& conn, const RpcMeta& meta, const StringPiece& payload);
+    // 连接上所有进行中的流
+    std::vector<std::shared_ptr<RpcStream>> ConnectionStreams(const StreamConnection* conn, bool erase);
+    // call 由调用方填好连接和响应方式, 这里解析请求并执行
+    void ProcRpcData(PendingCall* call, uint32_t method_id, uint32_t timeout_ms, const StringPiece& serialzied_data,
+                     bool compressed);
+    void SendError(const StreamConnectionPtr& conn, const int64_t id, bool fixed_header, const std::string& reason);
+    // 没有这个方法时返回 0
+    uint32_t FindMethodId(const std::string& service_name, const std::string& method_name) const;
+    // done 可以在任意线程执行, 完成顺序不必与请求顺序一致
+    void OnCallbackDone(PendingCall* call);
+    PendingCall* AcquireCall();
+    void ReleaseCall(PendingCall* call);
+    TaskThreadPool* MakeExecutor(ExecutorType executor, int num_threads, const std::string& name);
 
 private:
     struct ServiceInfo
     {
         ::google::protobuf::Service* service_;
         std::map<std::string, const ::google::protobuf::MethodDescriptor*> mdescriptor_;
+        std::map<std::string, TaskThreadPool*> executor_;  // NULL 表示在 IO 线程执行
+        std::map<std::string, uint32_t> method_id_;        // Start 时分配, 从 1 开始
+        std::map<std::string, size_t> compress_threshold_; // 没有的方法使用 RpcServer 的默认值
+    };
+    struct MethodInfo
+    {
+        ::google::protobuf::Service* service_;
+        const ::google::protobuf::MethodDescriptor* mdescriptor_;
+        TaskThreadPool* executor_;
+        size_t compress_threshold_;
     };
     std::map<std::string, ServiceInfo> services_;
+    // Start 之后只读, 多个 IO 线程可以不加锁地查, 下标为 method_id - 1
+    std::vector<MethodInfo> methods_;
+    bool started_;
+    RpcCodec codec_;
+    bool fixed_header_;
+    size_t compress_threshold_;
+    bool write_coalescing_;
     std::unique_ptr<StreamServer> server_;
-    std::weak_ptr<StreamConnection> basicConn_;
+    // 析构时先停线程池等待执行中的方法结束, 再停 server_
+    int worker_threads_;
+    std::unique_ptr<TaskThreadPool> shared_pool_;
+    std::vector<std::unique_ptr<TaskThreadPool>> dedicated_pools_;
+    // done 可能在工作线程执行, 归还时要加锁
+    std::mutex pool_mutex_;
+    std::vector<PendingCall*> free_calls_;
+    // 进行中的流式调用, 调用方的 id 只在连接内唯一
+    typedef std::pair<const StreamConnection*, int64_t> StreamKey;
+    std::mutex streams_mutex_;
+    std::map<StreamKey, std::shared_ptr<RpcStream>> streams_;
 };
 
 }
@@ -0,0 +1,363 @@
+#include "rpc_stream.h"
+#include "EventLoop.h"
+#include "StreamConnection.h"
+#include "rpc_codec.h"
+#include "rpc_meta.pb.h"
+#include "google/protobuf/empty.pb.h"
+
+namespace toyBasket
+{
+
+RpcStream::RpcStream()
+    : id_(0)
+    , codec_(NULL)
+    , compress_threshold_(0)
+    , batched_(false)
+    , credit_(0)
+    , consumed_(0)
+    , paused_(false)
+    , blocked_(false)
+    , closed_(false)
+    , peer_closed_(false)
+    , canceled_(false)
+    , finished_(false)
+{
+}
+
+void RpcStream::SetMessageCallback(const MessageCallback& cb)
+{
+    StreamConnectionPtr conn;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        message_callback_ = cb;
+        if (!pending_.empty() && !finished_)
+        {
+            conn = conn_.lock();
+        }
+    }
+    // 服务端的方法可能在工作线程上设置, 缓存的消息仍然回到 loop 线程处理
+    if (conn)
+    {
+        conn->getLoop()->runInLoop(std::bind(&RpcStream::DeliverPending, shared_from_this()));
+    }
+}
+
+void RpcStream::SetWritableCallback(const WritableCallback& cb)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    writable_callback_ = cb;
+}
+
+void RpcStream::SetCloseCallback(const CloseCallback& cb)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    close_callback_ = cb;
+}
+
+bool RpcStream::Write(const ::google::protobuf::Message& message)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    StreamConnectionPtr conn = conn_.lock();
+    if (!conn || closed_)
+    {
+        return false;
+    }
+    if (credit_ == 0 || paused_)
+    {
+        blocked_ = true;
+        return false;
+    }
+    --credit_;
+    // 持锁发送, 多个线程同时写时帧的顺序与额度的扣减一致
+    SendFrame(conn, kStreamData, 0, &message);
+    return true;
+}
+
+bool RpcStream::Writable() const
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    return !conn_.expired() && !closed_ && credit_ > 0 && !paused_;
+}
+
+void RpcStream::Close()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    StreamConnectionPtr conn = conn_.lock();
+    if (!conn || closed_)
+    {
+        return;
+    }
+    closed_ = true;
+    SendFrame(conn, kStreamEnd, 0, NULL);
+}
+
+bool RpcStream::IsCanceled() const
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    return canceled_;
+}
+
+void RpcStream::Attach(const StreamConnectionPtr& conn, int64_t id, const LengthHeaderCodec* codec,
+                       const ::google::protobuf::Message& prototype, size_t compress_threshold, bool batched)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    conn_               = conn;
+    id_                 = id;
+    codec_              = codec;
+    compress_threshold_ = compress_threshold;
+    batched_            = batched;
+    credit_             = kStreamWindow;
+    consumed_           = 0;
+    paused_             = false;
+    blocked_            = false;
+    closed_             = false;
+    peer_closed_        = false;
+    canceled_           = false;
+    finished_           = false;
+    pending_.clear();
+    message_.reset(prototype.New());
+}
+
+void RpcStream::OnData(const StringPiece& payload, bool compressed)
+{
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (finished_)
+        {
+            return;
+        }
+        // 回调还没设置, 或者缓存的消息还没处理完, 排在后面保持顺序
+        // 对方守额度时最多缓存 kStreamWindow 条
+        if (!message_callback_ || !pending_.empty())
+        {
+            pending_.push_back(PendingMessage(payload.as_string(), compressed));
+            return;
+        }
+    }
+    Deliver(payload, compressed);
+}
+
+void RpcStream::Deliver(const StringPiece& payload, bool compressed)
+{
+    MessageCallback cb;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (finished_)
+        {
+            return;
+        }
+        cb = message_callback_;
+    }
+    if (ParseRpcPayload(payload, compressed, message_.get()))
+    {
+        cb(*message_);
+    }
+    else
+    {
+        LOG_WARNING << "RpcStream: bad message in call " << id_;
+    }
+
+    // 处理完才还额度, 回调慢时对方自然停下来
+    std::unique_lock<std::mutex> lock(mutex_);
+    StreamConnectionPtr conn = conn_.lock();
+    if (conn && !finished_ && ++consumed_ >= kStreamWindow / 2)
+    {
+        SendFrame(conn, kStreamCredit, consumed_, NULL);
+        consumed_ = 0;
+    }
+}
+
+void RpcStream::DeliverPending()
+{
+    for (;;)
+    {
+        PendingMessage message;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            if (finished_ || !message_callback_ || pending_.empty())
+            {
+                return;
+            }
+            message.first.swap(pending_.front().first);
+            message.second = pending_.front().second;
+            pending_.pop_front();
+        }
+        Deliver(message.first, message.second);
+    }
+}
+
+void RpcStream::WatchHighWaterMark(const StreamConnectionPtr& conn, const StreamsGetter& streams)
+{
+    conn->setHighWaterMarkCallback(
+        [streams](const StreamConnectionPtr& c, size_t len) {
+            LOG_WARNING << "RpcStream: " << c->name() << " has " << len << " bytes pending, pause streams";
+            for (auto& stream : streams())
+            {
+                stream->SetPaused(true);
+            }
+            // 只在积压期间关注写完成, 平时每次发送都不必多排一个回调
+            c->setWriteCompleteCallback([streams](const StreamConnectionPtr& c2) {
+                c2->setWriteCompleteCallback(WriteCompleteCallback());
+                for (auto& stream : streams())
+                {
+                    stream->SetPaused(false);
+                }
+            });
+        },
+        kStreamHighWaterMark);
+}
+
+bool RpcStream::OnFrame(const RpcMeta& meta, const StringPiece& payload)
+{
+    switch (meta.stream())
+    {
+    case kStreamData:
+        OnData(payload, meta.compressed());
+        return true;
+    case kStreamCredit:
+        OnCredit(meta.credit());
+        return true;
+    case kStreamEnd:
+        OnEnd();
+        return true;
+    case kStreamCancel:
+        Abort();
+        return true;
+    default:
+        return false;
+    }
+}
+
+void RpcStream::OnCredit(uint32_t credit)
+{
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        credit_ += credit;
+    }
+    NotifyWritable();
+}
+
+void RpcStream::OnEnd()
+{
+    CloseCallback cb;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (finished_ || peer_closed_)
+        {
+            return;
+        }
+        peer_closed_ = true;
+        cb           = close_callback_;
+    }
+    if (cb)
+    {
+        cb();
+    }
+}
+
+void RpcStream::SetPaused(bool paused)
+{
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        paused_ = paused;
+    }
+    if (!paused)
+    {
+        NotifyWritable();
+    }
+}
+
+void RpcStream::Finish()
+{
+    MessageCallback message_callback;
+    WritableCallback writable_callback;
+    CloseCallback close_callback;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        finished_    = true;
+        closed_      = true;
+        peer_closed_ = true;
+        conn_.reset();
+        pending_.clear();
+        message_callback.swap(message_callback_);
+        writable_callback.swap(writable_callback_);
+        close_callback.swap(close_callback_);
+    }
+    // 回调可能持有使用方的对象, 在锁外释放
+}
+
+void RpcStream::Cancel()
+{
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        StreamConnectionPtr conn = conn_.lock();
+        if (conn && !finished_)
+        {
+            SendFrame(conn, kStreamCancel, 0, NULL);
+        }
+    }
+    Finish();
+}
+
+void RpcStream::Abort()
+{
+    CloseCallback cb;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (finished_)
+        {
+            return;
+        }
+        canceled_ = true;
+        if (!peer_closed_)
+        {
+            peer_closed_ = true;
+            cb           = close_callback_;
+        }
+    }
+    if (cb)
+    {
+        cb();
+    }
+    Finish();
+}
+
+void RpcStream::SendFrame(const StreamConnectionPtr& conn, uint32_t type, uint32_t credit,
+                          const ::google::protobuf::Message* message)
+{
+    RpcMeta rpc_meta;
+    rpc_meta.set_id(id_);
+    rpc_meta.set_stream(type);
+    rpc_meta.set_credit(credit);
+
+    std::string frame;
+    if (message)
+    {
+        SerializeRpcFrame(*codec_, &rpc_meta, *message, &frame, compress_threshold_);
+    }
+    else
+    {
+        SerializeRpcFrame(*codec_, &rpc_meta, google::protobuf::Empty(), &frame);
+    }
+    SendRpcFrame(conn, std::move(frame), batched_);
+}
+
+void RpcStream::NotifyWritable()
+{
+    WritableCallback cb;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (!blocked_ || closed_ || credit_ == 0 || paused_)
+        {
+            return;
+        }
+        blocked_ = false;
+        cb       = writable_callback_;
+    }
+    if (cb)
+    {
+        cb();
+    }
+}
+
+} // namespace toyBasket
@@ -0,0 +1,119 @@
+#ifndef _RPC_STREAM_H
+#define _RPC_STREAM_H
+
+#include <stdint.h>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "Callbacks.h"
+#include "StringPiece.h"
+#include "google/protobuf/message.h"
+
+namespace toyBasket
+{
+class LengthHeaderCodec;
+class RpcMeta;
+
+// 流式调用的帧类型, 放在 RpcMeta.stream 中, 0 表示普通的请求或响应; 流式帧只用 RpcMeta 帧
+const uint32_t kStreamData   = 1; // 一条消息
+const uint32_t kStreamEnd    = 2; // 发送方不会再发消息
+const uint32_t kStreamCredit = 3; // 接收方补充的额度, 条数在 RpcMeta.credit
+const uint32_t kStreamCancel = 4; // 调用方放弃这个调用
+
+// 每个方向初始的额度(消息条数), 接收方处理完一半后补充
+const uint32_t kStreamWindow = 64;
+// 连接的输出缓冲超过这么多字节时, 其上已有的流暂停写, 缓冲写空后恢复
+const size_t kStreamHighWaterMark = 4 * 1024 * 1024;
+
+// 流式调用(proto 中带 stream 的方法)的一端, 由 RpcController::Stream() 取得, 与普通调用共用连接, 按调用 id 区分
+// 调用方: 发起调用前设置回调, request 是第一条消息, 之后的消息用 Write 发送, Close 表示不再发送;
+//         服务端的消息经 MessageCallback 到达, done 执行时调用结束, response 是最后的结果
+// 服务端: 方法实现用 Write 发送消息, 执行 done 结束调用; 调用方后续的消息经 MessageCallback 到达
+// 流量控制: 每条消息用掉对方给的一个额度, 额度用完或连接积压时 Write 返回 false, 可以再写时执行 WritableCallback
+class RpcStream : public std::enable_shared_from_this<RpcStream>
+{
+public:
+    typedef std::function<void(const ::google::protobuf::Message&)> MessageCallback;
+    typedef std::function<void()> WritableCallback;
+    typedef std::function<void()> CloseCallback;
+
+    RpcStream();
+
+    // 在连接所在的 loop 线程执行, 回调返回后才给对方补充额度; 设置之前到达的消息先缓存
+    void SetMessageCallback(const MessageCallback& cb);
+    // Write 返回 false 之后, 额度补充且连接不再积压时执行一次
+    void SetWritableCallback(const WritableCallback& cb);
+    // 对方不会再发消息: 对方执行了 Close, 或者调用被取消, 连接断开
+    void SetCloseCallback(const CloseCallback& cb);
+
+    // 可以在任意线程调用; 额度不够, 连接积压或者调用已经结束时不发送, 返回 false
+    bool Write(const ::google::protobuf::Message& message);
+    bool Writable() const;
+    // 本端不再发送消息
+    void Close();
+    // 调用方已经取消, 或者连接已经断开
+    bool IsCanceled() const;
+
+private:
+    friend class RpcChannel;
+    friend class RpcServer;
+
+    typedef std::pair<std::string, bool> PendingMessage; // payload, 是否压缩
+    typedef std::function<std::vector<std::shared_ptr<RpcStream>>()> StreamsGetter;
+
+    // 绑定到连接上的一次调用, prototype 是对方所发消息的类型
+    void Attach(const StreamConnectionPtr& conn, int64_t id, const LengthHeaderCodec* codec,
+                const ::google::protobuf::Message& prototype, size_t compress_threshold, bool batched);
+    // 连接积压时暂停 streams() 取得的流, 输出缓冲写空后恢复
+    static void WatchHighWaterMark(const StreamConnectionPtr& conn, const StreamsGetter& streams);
+
+    // 以下由 RpcChannel/RpcServer 在 loop 线程调用
+    // 按帧类型分发, 不认识的类型返回 false
+    bool OnFrame(const RpcMeta& meta, const StringPiece& payload);
+    void OnData(const StringPiece& payload, bool compressed);
+    void OnCredit(uint32_t credit);
+    void OnEnd();
+    void SetPaused(bool paused);
+    // 调用结束, 之后不再收发, 回调随之释放
+    void Finish();
+    // 调用方放弃调用, 通知对方后结束
+    void Cancel();
+    // 对方取消或者连接断开, 执行 CloseCallback 后结束
+    void Abort();
+
+    void Deliver(const StringPiece& payload, bool compressed);
+    void DeliverPending();
+    // 须持有 mutex_
+    void SendFrame(const StreamConnectionPtr& conn, uint32_t type, uint32_t credit,
+                   const ::google::protobuf::Message* message);
+    // 可写且有人在等时执行 WritableCallback, 不能持有 mutex_
+    void NotifyWritable();
+
+private:
+    mutable std::mutex mutex_; // Write 可以在工作线程, 收到的帧都在 loop 线程
+    std::weak_ptr<StreamConnection> conn_;
+    int64_t id_;
+    const LengthHeaderCodec* codec_;
+    size_t compress_threshold_;
+    bool batched_;      // 帧与同一轮 loop 的其它帧合并发送
+    uint32_t credit_;   // 还能发送的消息条数
+    uint32_t consumed_; // 已处理但还没还给对方的额度
+    bool paused_;       // 连接积压
+    bool blocked_;      // Write 返回过 false, 等待可写
+    bool closed_;       // 本端不再发送
+    bool peer_closed_;  // 对方不再发送
+    bool canceled_;
+    bool finished_;
+    MessageCallback message_callback_;
+    WritableCallback writable_callback_;
+    CloseCallback close_callback_;
+    std::deque<PendingMessage> pending_;
+    std::unique_ptr<::google::protobuf::Message> message_; // 只在 loop 线程上用来解析收到的消息
+};
+
+}
+
+#endif
@@ -0,0 +1,125 @@
+/******************************************************************************
+ * File name     : TaskEventLoopThreadPool.cpp
+ * Description   :
+ * Version       : v1.0
+ * Create Time   : 2026/10/17
+ * Author        : andy
+ * Modify history:
+ *******************************************************************************
+ * Modify Time   Modify person  Modification
+ * ------------------------------------------------------------------------------
+ *
+ *******************************************************************************/
+
+#include "TaskEventLoopThreadPool.h"
+#include "EventLoop.h"
+#include "TaskEventLoopThread.h"
+
+#include <cassert>
+
+using namespace toyBasket;
+
+TaskEventLoopThreadPool::TaskEventLoopThreadPool(EventLoop* baseLoop, const std::string& nameArg)
+    : baseLoop_(baseLoop)
+    , name_(nameArg)
+    , started_(false)
+    , numThreads_(0)
+    , next_(0)
+{
+}
+
+TaskEventLoopThreadPool::~TaskEventLoopThreadPool()
+{
+    // Don't delete loop, it's stack variable
+}
+
+void TaskEventLoopThreadPool::start(const ThreadInitCallback& cb)
+{
+    assert(!started_);
+    baseLoop_->assertInLoopThread();
+
+    started_ = true;
+
+    for (int i = 0; i < numThreads_; ++i)
+    {
+        TaskEventLoopThread* t = new TaskEventLoopThread(cb);
+        threads_.push_back(std::unique_ptr<TaskEventLoopThread>(t));
+        loops_.push_back(t->startLoop());
+    }
+    if (numThreads_ == 0 && cb)
+    {
+        cb(baseLoop_);
+    }
+}
+
+EventLoop* TaskEventLoopThreadPool::getNextLoop()
+{
+    baseLoop_->assertInLoopThread();
+    assert(started_);
+    EventLoop* loop = baseLoop_;
+
+    if (!loops_.empty())
+    {
+        // round-robin
+        loop = loops_[next_];
+        ++next_;
+        if (next_ >= loops_.size())
+        {
+            next_ = 0;
+        }
+    }
+    return loop;
+}
+
+EventLoop* TaskEventLoopThreadPool::getLeastQueuedLoop()
+{
+    baseLoop_->assertInLoopThread();
+    assert(started_);
+    EventLoop* loop = baseLoop_;
+
+    if (!loops_.empty())
+    {
+        // start scanning after the last pick, so ties still spread round-robin
+        size_t best      = next_;
+        size_t bestQueue = loops_[best]->queueSize();
+        for (size_t i = 1; i < loops_.size() && bestQueue > 0; ++i)
+        {
+            size_t idx   = (next_ + i) % loops_.size();
+            size_t queue = loops_[idx]->queueSize();
+            if (queue < bestQueue)
+            {
+                best      = idx;
+                bestQueue = queue;
+            }
+        }
+        loop  = loops_[best];
+        next_ = (best + 1) % loops_.size();
+    }
+    return loop;
+}
+
+EventLoop* TaskEventLoopThreadPool::getLoopForHash(size_t hashCode)
+{
+    baseLoop_->assertInLoopThread();
+    EventLoop* loop = baseLoop_;
+
+    if (!loops_.empty())
+    {
+        loop = loops_[hashCode % loops_.size()];
+    }
+    return loop;
+}
+
+std::vector<EventLoop*> TaskEventLoopThreadPool::getAllLoops()
+{
+    baseLoop_->assertInLoopThread();
+    assert(started_);
+    if (loops_.empty())
+    {
+        return std::vector<EventLoop*>(1, baseLoop_);
+    }
+    else
+    {
+        return loops_;
+    }
+}
@@ -0,0 +1,87 @@
+/******************************************************************************
+ * File name     : TaskEventLoopThreadPool.h
+ * Description   :
+ * Version       : v1.0
+ * Create Time   : 2026/10/17
+ * Author        : andy
+ * Modify history:
+ *******************************************************************************
+ * Modify Time   Modify person  Modification
+ * ------------------------------------------------------------------------------
+ *
+ *******************************************************************************/
+
+#ifndef _TASKEVENTLOOPTHREADPOOL_H
+#define _TASKEVENTLOOPTHREADPOOL_H
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "noncopyable.h"
+
+namespace toyBasket
+{
+
+class EventLoop;
+class TaskEventLoopThread;
+
+///
+/// A fixed set of I/O loops, each running in its own TaskEventLoopThread.
+///
+/// With zero threads every getter falls back to the base loop,
+/// so callers do not need a single-threaded special case.
+class TaskEventLoopThreadPool : noncopyable
+{
+public:
+    typedef std::function<void(EventLoop*)> ThreadInitCallback;
+
+    TaskEventLoopThreadPool(EventLoop* baseLoop, const std::string& nameArg);
+    ~TaskEventLoopThreadPool();
+
+    /// Must be called before start().
+    void setThreadNum(int numThreads)
+    {
+        numThreads_ = numThreads;
+    }
+
+    /// Starts all threads, blocks until every loop is running.
+    /// Must be called in the base loop thread.
+    void start(const ThreadInitCallback& cb = ThreadInitCallback());
+
+    /// Round-robin.
+    /// Valid after calling start().
+    EventLoop* getNextLoop();
+
+    /// The loop with the fewest functors waiting in its pending queue.
+    EventLoop* getLeastQueuedLoop();
+
+    /// With the same hash code, it will always return the same EventLoop.
+    EventLoop* getLoopForHash(size_t hashCode);
+
+    std::vector<EventLoop*> getAllLoops();
+
+    bool started() const
+    {
+        return started_;
+    }
+
+    const std::string& name() const
+    {
+        return name_;
+    }
+
+private:
+    EventLoop* baseLoop_;
+    std::string name_;
+    bool started_;
+    int numThreads_;
+    size_t next_;
+    std::vector<std::unique_ptr<TaskEventLoopThread>> threads_;
+    std::vector<EventLoop*> loops_;
+};
+
+} // namespace toyBasket
+
+#endif // _TASKEVENTLOOPTHREADPOOL_H
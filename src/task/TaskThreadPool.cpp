@@ -0,0 +1,111 @@
+/******************************************************************************
+ * File name     : TaskThreadPool.cpp
+ * Description   :
+ * Version       : v1.0
+ * Create Time   : 2026/10/17
+ * Author        : andy
+ * Modify history:
+ *******************************************************************************
+ * Modify Time   Modify person  Modification
+ * ------------------------------------------------------------------------------
+ *
+ *******************************************************************************/
+
+#include "TaskThreadPool.h"
+
+#include <cassert>
+
+using namespace toyBasket;
+
+TaskThreadPool::TaskThreadPool(const std::string& nameArg)
+    : name_(nameArg)
+    , numThreads_(0)
+    , running_(false)
+    , submitting_(0)
+{
+}
+
+TaskThreadPool::~TaskThreadPool()
+{
+    stop();
+}
+
+void TaskThreadPool::start()
+{
+    assert(threads_.empty());
+    running_ = true;
+    for (int i = 0; i < numThreads_; ++i)
+    {
+        threads_.push_back(std::unique_ptr<std::thread>(new std::thread(&TaskThreadPool::runInThread, this)));
+    }
+}
+
+void TaskThreadPool::stop()
+{
+    if (!running_.exchange(false))
+    {
+        return;
+    }
+
+    // one empty task per worker, each worker exits on the first it takes
+    for (size_t i = 0; i < threads_.size(); ++i)
+    {
+        queue_.put(Task());
+    }
+    for (auto& thr : threads_)
+    {
+        thr->join();
+    }
+    threads_.clear();
+
+    // tasks queued behind the empty ones, and by run() calls that saw us
+    // still running, run here instead of being lost
+    while (submitting_.load() > 0 || queue_.size() > 0)
+    {
+        if (queue_.size() == 0)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        Task task(queue_.take());
+        if (task)
+        {
+            task();
+        }
+    }
+}
+
+bool TaskThreadPool::run(Task task)
+{
+    // pairs with stop(): either we see running_ cleared, or stop() waits for our task
+    ++submitting_;
+    if (!running_.load())
+    {
+        --submitting_;
+        return false;
+    }
+    if (numThreads_ == 0)
+    {
+        --submitting_;
+        task();
+    }
+    else
+    {
+        queue_.put(std::move(task));
+        --submitting_;
+    }
+    return true;
+}
+
+void TaskThreadPool::runInThread()
+{
+    while (true)
+    {
+        Task task(queue_.take());
+        if (!task)
+        {
+            break;
+        }
+        task();
+    }
+}
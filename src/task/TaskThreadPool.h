@@ -0,0 +1,81 @@
+/******************************************************************************
+ * File name     : TaskThreadPool.h
+ * Description   :
+ * Version       : v1.0
+ * Create Time   : 2026/10/17
+ * Author        : andy
+ * Modify history:
+ *******************************************************************************
+ * Modify Time   Modify person  Modification
+ * ------------------------------------------------------------------------------
+ *
+ *******************************************************************************/
+
+#ifndef _TASKTHREADPOOL_H
+#define _TASKTHREADPOOL_H
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "BlockingQueue.h"
+#include "noncopyable.h"
+
+namespace toyBasket
+{
+
+///
+/// Worker threads sharing one task queue.
+///
+/// Unlike TaskEventLoopThreadPool, a task goes to whichever worker is free
+/// first, so one long task never holds up the tasks queued behind it.
+class TaskThreadPool : noncopyable
+{
+public:
+    typedef std::function<void()> Task;
+
+    explicit TaskThreadPool(const std::string& nameArg = std::string("TaskThreadPool"));
+    ~TaskThreadPool();
+
+    /// Must be called before start().
+    void setThreadNum(int numThreads)
+    {
+        numThreads_ = numThreads;
+    }
+
+    void start();
+    /// Waits for the workers, tasks queued until then still run.
+    void stop();
+
+    /// Queues @c task, it runs in the calling thread if the pool has no threads.
+    /// Thread safe.
+    /// @return false if the pool is not running, @c task is dropped
+    bool run(Task task);
+
+    size_t queueSize() const
+    {
+        return queue_.size();
+    }
+
+    const std::string& name() const
+    {
+        return name_;
+    }
+
+private:
+    void runInThread();
+
+    std::string name_;
+    int numThreads_;
+    std::atomic<bool> running_;
+    std::atomic<int> submitting_; // run() calls between checking running_ and queueing
+    std::vector<std::unique_ptr<std::thread>> threads_;
+    BlockingQueue<Task> queue_;
+};
+
+} // namespace toyBasket
+
+#endif // _TASKTHREADPOOL_H